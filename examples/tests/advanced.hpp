@@ -1,21 +1,24 @@
 #pragma once
 
+#include <algorithm>
+#include <span>
 #include <unordered_map>
 #include <vector>
 
 #include "autd3.hpp"
 
-class BurstModulation final : public autd3::Modulation<BurstModulation> {
+class BurstModulation final : public autd3::ModulationInto<BurstModulation> {
  public:
-  std::vector<autd3::EmitIntensity> calc() const override {
-    std::vector<autd3::EmitIntensity> buffer(_buf_size, autd3::EmitIntensity::minimum());
+  [[nodiscard]] size_t required_size() const override { return _buf_size; }
+
+  void calc_into(const std::span<autd3::EmitIntensity> buffer) const override {
+    std::ranges::fill(buffer, autd3::EmitIntensity::minimum());
     buffer[_buf_size - 1] = autd3::EmitIntensity::maximum();
-    return buffer;
   }
 
   explicit BurstModulation(const size_t buf_size = 4000,
                            const autd3::SamplingConfiguration config = autd3::SamplingConfiguration::from_frequency(4e3)) noexcept
-      : Modulation(config), _buf_size(buf_size) {}
+      : ModulationInto(config), _buf_size(buf_size) {}
 
  private:
   size_t _buf_size;
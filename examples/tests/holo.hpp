@@ -15,7 +15,7 @@ inline coro::task<void> holo_test(autd3::Controller<L>& autd) {
   auto silencer = autd3::ConfigureSilencer::default_();
   co_await autd.send_async(silencer);
 
-  autd3::modulation::Sine m(150);  // 150Hz AM
+  autd3::modulation::FixedSine<150> m;  // 150Hz AM
 
   const autd3::Vector3 center = autd.geometry().center() + autd3::Vector3(0.0, 0.0, 150.0);
 
@@ -28,14 +28,22 @@
 #include "autd3/gain/gain.hpp"
 #include "autd3/gain/group.hpp"
 #include "autd3/gain/null.hpp"
+#include "autd3/gain/pattern_library.hpp"
 #include "autd3/gain/plane.hpp"
+#include "autd3/gain/sparse.hpp"
 #include "autd3/gain/trans_test.hpp"
 #include "autd3/gain/uniform.hpp"
+#include "autd3/modulation/custom.hpp"
+#include "autd3/modulation/effect_bank.hpp"
+#include "autd3/modulation/fixed.hpp"
 #include "autd3/modulation/fourier.hpp"
+#include "autd3/modulation/mixer.hpp"
 #include "autd3/modulation/modulation.hpp"
+#include "autd3/modulation/sequence.hpp"
 #include "autd3/modulation/sine.hpp"
 #include "autd3/modulation/square.hpp"
 #include "autd3/modulation/static.hpp"
+#include "autd3/stm/trajectory.hpp"
 
 namespace autd3 {
 
@@ -60,12 +68,15 @@ using driver::geometry::Transducer;
 using driver::Drive;
 using driver::EmitIntensity;
 using driver::LoopBehavior;
+using driver::ModulationBuffer;
 using driver::Phase;
 using gain::Gain;
 constexpr driver::UnitPhaseRad phase_rad = driver::rad;
 using driver::SamplingConfiguration;
 using modulation::Modulation;
+using modulation::ModulationInto;
 
+using driver::BasicGainSTM;
 using driver::ChangeFocusSTMSegment;
 using driver::ChangeGainSegment;
 using driver::ChangeGainSTMSegment;
@@ -85,11 +96,21 @@ using gain::Bessel;
 using gain::Focus;
 using gain::Group;
 using gain::Null;
+using gain::PatternLibrary;
+using gain::PatternLibraryWriter;
 using gain::Plane;
+using gain::Sparse;
 using gain::TransducerTest;
 using gain::Uniform;
 
+using modulation::Custom;
+using modulation::EffectBank;
+using modulation::EffectBankWriter;
+using modulation::FixedSine;
+using modulation::FixedSquare;
+using modulation::Mixer;
 using modulation::SamplingMode;
+using modulation::Sequence;
 using modulation::Sine;
 using modulation::Square;
 using modulation::Static;
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <utility>
+
+#ifdef WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "autd3/exception.hpp"
+
+namespace autd3::driver {
+
+/**
+ * @brief Read-only memory mapping of a file
+ */
+class MappedFile final {
+ public:
+  explicit MappedFile(const std::filesystem::path& path) {
+#ifdef WIN32
+    const auto file = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) throw AUTDException("Failed to open " + path.string());
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+      CloseHandle(file);
+      throw AUTDException("Failed to get size of " + path.string());
+    }
+    _size = static_cast<size_t>(size.QuadPart);
+    if (_size > 0) {
+      _mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      if (_mapping != nullptr) _data = static_cast<const uint8_t*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+    }
+    CloseHandle(file);
+#else
+    const auto fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw AUTDException("Failed to open " + path.string());
+    struct stat st {};
+    if (fstat(fd, &st) != 0) {
+      close(fd);
+      throw AUTDException("Failed to get size of " + path.string());
+    }
+    _size = static_cast<size_t>(st.st_size);
+    if (_size > 0) {
+      if (auto* p = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0); p != MAP_FAILED) _data = static_cast<const uint8_t*>(p);
+    }
+    close(fd);
+#endif
+    if (_size > 0 && _data == nullptr) {
+      unmap();
+      throw AUTDException("Failed to map " + path.string());
+    }
+  }
+
+  MappedFile(const MappedFile& v) = delete;
+  MappedFile& operator=(const MappedFile& obj) = delete;
+  MappedFile(MappedFile&& obj) noexcept { *this = std::move(obj); }
+  MappedFile& operator=(MappedFile&& obj) noexcept {
+    if (this != &obj) {
+      unmap();
+      std::swap(_data, obj._data);
+      std::swap(_size, obj._size);
+#ifdef WIN32
+      std::swap(_mapping, obj._mapping);
+#endif
+    }
+    return *this;
+  }
+  ~MappedFile() noexcept { unmap(); }
+
+  [[nodiscard]] const uint8_t* data() const noexcept { return _data; }
+  [[nodiscard]] size_t size() const noexcept { return _size; }
+  [[nodiscard]] std::span<const uint8_t> bytes() const noexcept { return {_data, _size}; }
+
+ private:
+  void unmap() noexcept {
+#ifdef WIN32
+    if (_data != nullptr) UnmapViewOfFile(_data);
+    if (_mapping != nullptr) CloseHandle(_mapping);
+    _mapping = nullptr;
+#else
+    if (_data != nullptr) munmap(const_cast<uint8_t*>(_data), _size);
+#endif
+    _data = nullptr;
+    _size = 0;
+  }
+
+  const uint8_t* _data{nullptr};
+  size_t _size{0};
+#ifdef WIN32
+  HANDLE _mapping{nullptr};
+#endif
+};
+
+}  // namespace autd3::driver
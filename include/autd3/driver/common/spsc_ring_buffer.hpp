@@ -0,0 +1,74 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "autd3/exception.hpp"
+
+namespace autd3::driver {
+
+/**
+ * @brief Lock-free ring buffer for a single producer and a single consumer
+ * @details push must be called only from one thread and pop only from another one. The capacity is rounded up to a power of two.
+ */
+template <class T>
+  requires std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>
+class SpscRingBuffer final {
+ public:
+  explicit SpscRingBuffer(const size_t capacity) : _buf(std::bit_ceil(capacity)), _mask(_buf.size() - 1) {
+    if (capacity == 0) throw AUTDException("Capacity must be positive");
+  }
+  SpscRingBuffer(const SpscRingBuffer& v) = delete;
+  SpscRingBuffer& operator=(const SpscRingBuffer& obj) = delete;
+  SpscRingBuffer(SpscRingBuffer&& obj) = delete;
+  SpscRingBuffer& operator=(SpscRingBuffer&& obj) = delete;
+  ~SpscRingBuffer() = default;  // LCOV_EXCL_LINE
+
+  [[nodiscard]] size_t capacity() const noexcept { return _buf.size(); }
+
+  /**
+   * @brief Get the number of elements which can be popped
+   */
+  [[nodiscard]] size_t size() const noexcept { return _tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire); }
+
+  /**
+   * @brief Push elements as many as possible
+   *
+   * @return Number of elements pushed, which is less than requested if the buffer is full
+   */
+  size_t push(const std::span<const T> data) noexcept {
+    const auto tail = _tail.load(std::memory_order_relaxed);
+    const auto head = _head.load(std::memory_order_acquire);
+    const auto n = std::min(data.size(), capacity() - (tail - head));
+    for (size_t i = 0; i < n; i++) _buf[(tail + i) & _mask] = data[i];
+    _tail.store(tail + n, std::memory_order_release);
+    return n;
+  }
+
+  /**
+   * @brief Pop elements as many as possible
+   *
+   * @return Number of elements popped, which is less than requested if the buffer becomes empty
+   */
+  size_t pop(const std::span<T> data) noexcept {
+    const auto head = _head.load(std::memory_order_relaxed);
+    const auto tail = _tail.load(std::memory_order_acquire);
+    const auto n = std::min(data.size(), tail - head);
+    for (size_t i = 0; i < n; i++) data[i] = _buf[(head + i) & _mask];
+    _head.store(head + n, std::memory_order_release);
+    return n;
+  }
+
+ private:
+  std::vector<T> _buf;
+  size_t _mask;
+  alignas(64) std::atomic<size_t> _head{0};
+  alignas(64) std::atomic<size_t> _tail{0};
+};
+
+}  // namespace autd3::driver
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <memory>
 #include <type_traits>
+#include <variant>
 
 #include "autd3/driver/datagram/with_segment.hpp"
 #include "autd3/driver/geometry/geometry.hpp"
@@ -32,6 +34,47 @@ class GainBase : public DatagramS<native_methods::GainPtr> {
 template <class G>
 concept gain = std::derived_from<std::remove_reference_t<G>, GainBase>;
 
+/**
+ * @brief Gain which can be stored in a container parameterized by Gs
+ * @details If Gs is empty, any gain is accepted.
+ */
+template <class G, class... Gs>
+concept gain_of = gain<G> && (sizeof...(Gs) == 0 || (std::same_as<std::remove_cvref_t<G>, Gs> || ...));
+
+/**
+ * @brief Storage of gains in gain containers
+ * @details The gains are stored inline as std::variant<Gs...> and their gain_ptr is dispatched statically.
+ */
+template <gain... Gs>
+struct GainHolder {
+  using type = std::variant<Gs...>;
+
+  template <gain_of<Gs...> G>
+  [[nodiscard]] static type make(G&& g) {
+    return type(std::in_place_type<std::remove_cvref_t<G>>, std::forward<G>(g));
+  }
+
+  [[nodiscard]] static native_methods::GainPtr gain_ptr(const type& g, const geometry::Geometry& geometry) {
+    return std::visit([&geometry](const auto& v) { return v.gain_ptr(geometry); }, g);
+  }
+};
+
+/**
+ * @brief Storage of gains in gain containers
+ * @details The gains are type-erased and allocated on the heap.
+ */
+template <>
+struct GainHolder<> {
+  using type = std::shared_ptr<GainBase>;
+
+  template <gain G>
+  [[nodiscard]] static type make(G&& g) {
+    return std::make_shared<std::remove_cvref_t<G>>(std::forward<G>(g));
+  }
+
+  [[nodiscard]] static native_methods::GainPtr gain_ptr(const type& g, const geometry::Geometry& geometry) { return g->gain_ptr(geometry); }
+};
+
 class ChangeGainSegment final {
  public:
   explicit ChangeGainSegment(const native_methods::Segment segment) : _segment(segment){};
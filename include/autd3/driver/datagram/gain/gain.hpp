@@ -4,6 +4,7 @@
 #include <type_traits>
 
 #include "autd3/driver/datagram/gain/cache.hpp"
+#include "autd3/driver/datagram/gain/prefetch.hpp"
 #include "autd3/driver/datagram/gain/transform.hpp"
 #include "autd3/driver/datagram/with_segment.hpp"
 #include "autd3/driver/geometry/geometry.hpp"
@@ -12,7 +13,11 @@
 namespace autd3::driver {
 
 template <class G>
-class Gain : public GainBase, public IntoDatagramWithSegment<native_methods::GainPtr, G>, public IntoGainCache<G>, public IntoGainTransform<G> {
+class Gain : public GainBase,
+             public IntoDatagramWithSegment<native_methods::GainPtr, G>,
+             public IntoGainCache<G>,
+             public IntoGainTransform<G>,
+             public IntoGainPrefetch<G> {
  public:
   Gain() = default;                            // LCOV_EXCL_LINE
   Gain(const Gain& obj) = default;             // LCOV_EXCL_LINE
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <numeric>
+#include <unordered_map>
+#include <vector>
+
+#include "autd3/driver/common/drive.hpp"
+#include "autd3/driver/common/phase.hpp"
+#include "autd3/driver/datagram/gain/base.hpp"
+#include "autd3/driver/datagram/with_segment.hpp"
+#include "autd3/driver/geometry/geometry.hpp"
+#include "autd3/exception.hpp"
+#include "autd3/native_methods.hpp"
+#include "autd3/native_methods/utils.hpp"
+
+namespace autd3::gain {
+
+/**
+ * @brief Gain to calculate in background
+ * @details The calculation starts on a worker thread when this object is constructed, and gain_ptr only waits for the result. The geometry must
+ * not be modified until the calculation finishes. If a device is enabled after the construction, gain_ptr throws AUTDException.
+ */
+template <class G>
+class Prefetch final : public driver::GainBase, public driver::IntoDatagramWithSegment<native_methods::GainPtr, Prefetch<G>> {
+ public:
+  Prefetch(G g, const driver::geometry::Geometry& geometry)
+      : _drives(std::async(std::launch::async, [g = std::move(g), geometry] { return calc(g, geometry); }).share()) {}
+
+  Prefetch() = delete;                                 // LCOV_EXCL_LINE
+  Prefetch(const Prefetch& obj) = default;             // LCOV_EXCL_LINE
+  Prefetch& operator=(const Prefetch& obj) = default;  // LCOV_EXCL_LINE
+  Prefetch(Prefetch&& obj) = default;                  // LCOV_EXCL_LINE
+  Prefetch& operator=(Prefetch&& obj) = default;       // LCOV_EXCL_LINE
+  ~Prefetch() override = default;                      // LCOV_EXCL_LINE
+
+  /**
+   * @brief Check if the calculation has finished
+   */
+  [[nodiscard]] bool is_ready() const { return _drives.wait_for(std::chrono::seconds(0)) == std::future_status::ready; }
+
+  /**
+   * @brief Wait for the calculation to finish
+   */
+  void wait() const { _drives.wait(); }
+
+  [[nodiscard]] native_methods::GainPtr gain_ptr(const driver::geometry::Geometry& geometry) const override {
+    const auto& drives = _drives.get();
+    if (std::ranges::any_of(geometry.devices(), [&drives](const driver::geometry::Device& dev) { return !drives.contains(dev.idx()); }))
+      throw AUTDException("Device set has changed since the prefetch was started");
+    return std::accumulate(geometry.devices().begin(), geometry.devices().end(), native_methods::AUTDGainCustom(),
+                           [&drives](const native_methods::GainPtr acc, const driver::geometry::Device& dev) {
+                             return AUTDGainCustomSet(acc, static_cast<uint32_t>(dev.idx()),
+                                                      reinterpret_cast<const native_methods::Drive*>(drives.at(dev.idx()).data()),
+                                                      static_cast<uint32_t>(drives.at(dev.idx()).size()));
+                           });
+  }
+
+  [[nodiscard]] const std::unordered_map<size_t, std::vector<driver::Drive>>& drives() const { return _drives.get(); }
+
+ private:
+  [[nodiscard]] static std::unordered_map<size_t, std::vector<driver::Drive>> calc(const G& g, const driver::geometry::Geometry& geometry) {
+    std::unordered_map<size_t, std::vector<driver::Drive>> drives;
+    const auto res = validate(native_methods::AUTDGainCalc(g.gain_ptr(geometry), geometry.ptr()));
+    for (const auto& dev : geometry.devices()) {
+      std::vector<driver::Drive> d;
+      d.resize(dev.num_transducers(), driver::Drive{driver::Phase(0), 0});
+      native_methods::AUTDGainCalcGetResult(res, reinterpret_cast<native_methods::Drive*>(d.data()), static_cast<uint32_t>(dev.idx()));
+      drives.emplace(dev.idx(), std::move(d));
+    }
+    native_methods::AUTDGainCalcFreeResult(res);
+    return drives;
+  }
+
+  std::shared_future<std::unordered_map<size_t, std::vector<driver::Drive>>> _drives;
+};
+
+}  // namespace autd3::gain
+
+namespace autd3::driver {
+
+template <class G>
+class IntoGainPrefetch {
+ public:
+  IntoGainPrefetch() = default;                                        // LCOV_EXCL_LINE
+  IntoGainPrefetch(const IntoGainPrefetch& obj) = default;             // LCOV_EXCL_LINE
+  IntoGainPrefetch& operator=(const IntoGainPrefetch& obj) = default;  // LCOV_EXCL_LINE
+  IntoGainPrefetch(IntoGainPrefetch&& obj) = default;                  // LCOV_EXCL_LINE
+  IntoGainPrefetch& operator=(IntoGainPrefetch&& obj) = default;       // LCOV_EXCL_LINE
+  virtual ~IntoGainPrefetch() = default;                               // LCOV_EXCL_LINE
+
+  [[nodiscard]] gain::Prefetch<G> with_prefetch(const geometry::Geometry& geometry) & { return gain::Prefetch(*static_cast<G*>(this), geometry); }
+  [[nodiscard]] gain::Prefetch<G> with_prefetch(const geometry::Geometry& geometry) && {
+    return gain::Prefetch(std::move(*static_cast<G*>(this)), geometry);
+  }
+};
+
+}  // namespace autd3::driver
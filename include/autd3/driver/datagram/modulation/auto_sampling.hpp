@@ -0,0 +1,139 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "autd3/driver/common/emit_intensity.hpp"
+#include "autd3/driver/common/sampling_config.hpp"
+#include "autd3/driver/datagram/modulation/base.hpp"
+#include "autd3/driver/datagram/modulation/buffer.hpp"
+#include "autd3/driver/datagram/modulation/cache.hpp"
+#include "autd3/driver/datagram/modulation/radiation_pressure.hpp"
+#include "autd3/native_methods.hpp"
+
+namespace autd3::modulation {
+
+/**
+ * @brief Modulation to send the result of calculation with the lowest sampling frequency meeting the tolerance
+ * @details The data is decimated by the largest factor `k` which divides the number of data, so that the period is kept. Since each sample is held
+ * until the next one on the device, every block of `k` samples is replaced by the midpoint of its minimum and maximum, and the factor is accepted
+ * if the played waveform differs from the original by at most the tolerance. The sampling frequency division is multiplied by `k`. The result is
+ * memoized and shared among the copies of this object.
+ */
+template <class M>
+class AutoSampling final : public driver::ModulationBase<AutoSampling<M>>,
+                           public driver::IntoModulationCache<AutoSampling<M>>,
+                           public driver::IntoRadiationPressure<AutoSampling<M>> {
+  using cache_t = std::optional<std::pair<driver::ModulationBuffer, driver::SamplingConfiguration>>;
+
+ public:
+  explicit AutoSampling(M m, const uint8_t tolerance = 0) : _m(std::move(m)), _tolerance(tolerance), _cache(std::make_shared<cache_t>()) {
+    this->_loop_behavior = _m.loop_behavior();
+  }
+
+  [[nodiscard]] uint8_t tolerance() const noexcept { return _tolerance; }
+
+  /**
+   * @brief Calculate the modulation data and decimate it
+   *
+   * @return Pair of the decimated data and its sampling configuration
+   */
+  [[nodiscard]] std::pair<driver::ModulationBuffer, driver::SamplingConfiguration> calc() const { return init(); }
+
+  [[nodiscard]] const driver::ModulationBuffer& buffer() const { return init().first; }
+
+  [[nodiscard]] driver::SamplingConfiguration sampling_config() const override { return init().second; }
+
+  [[nodiscard]] size_t size() const override { return init().first.size(); }
+
+  [[nodiscard]] native_methods::ModulationPtr modulation_ptr() const override {
+    const auto& [buf, config] = init();
+    return AUTDModulationCustom(static_cast<native_methods::SamplingConfiguration>(config), reinterpret_cast<const uint8_t*>(buf.data()),
+                                static_cast<uint64_t>(buf.size()), static_cast<native_methods::LoopBehavior>(this->_loop_behavior));
+  }
+
+  /**
+   * @brief Get the largest decimation factor meeting the tolerance
+   *
+   * @param data Modulation data
+   * @param max_factor Maximum factor
+   * @param tolerance Maximum difference between the original and the decimated waveform
+   */
+  [[nodiscard]] static size_t factor(const std::span<const driver::EmitIntensity> data, const size_t max_factor, const uint8_t tolerance) {
+    const auto n = data.size();
+    for (auto k = std::min(n / 2, max_factor); k > 1; k--) {
+      if (n % k != 0) continue;
+      bool ok = true;
+      for (size_t base = 0; base < n && ok; base += k) {
+        const auto [lo, hi] = std::ranges::minmax(data.subspan(base, k), {}, &driver::EmitIntensity::value);
+        ok = hi.value() - mid(lo.value(), hi.value()) <= tolerance;
+      }
+      if (ok) return k;
+    }
+    return 1;
+  }
+
+  /**
+   * @brief Replace every block of `k` samples by the midpoint of its minimum and maximum
+   */
+  [[nodiscard]] static std::vector<driver::EmitIntensity> decimate(const std::span<const driver::EmitIntensity> data, const size_t k) {
+    std::vector<driver::EmitIntensity> out;
+    out.reserve(data.size() / k);
+    for (size_t base = 0; base + k <= data.size(); base += k) {
+      const auto [lo, hi] = std::ranges::minmax(data.subspan(base, k), {}, &driver::EmitIntensity::value);
+      out.emplace_back(static_cast<uint8_t>(mid(lo.value(), hi.value())));
+    }
+    return out;
+  }
+
+ private:
+  const std::pair<driver::ModulationBuffer, driver::SamplingConfiguration>& init() const {
+    if (!_cache->has_value()) {
+      const auto [buf, config] = driver::calc_modulation(_m);
+      const auto div = config.frequency_division();
+      const auto k = factor(buf.span(), std::numeric_limits<uint32_t>::max() / div, _tolerance);
+      if (k == 1)
+        *_cache = std::make_pair(buf, config);
+      else
+        *_cache = std::make_pair(driver::ModulationBuffer(decimate(buf.span(), k)),
+                                 driver::SamplingConfiguration::from_frequency_division(div * static_cast<uint32_t>(k)));
+    }
+    return _cache->value();
+  }
+
+  [[nodiscard]] static int mid(const uint8_t lo, const uint8_t hi) noexcept { return (static_cast<int>(lo) + static_cast<int>(hi)) / 2; }
+
+  M _m;
+  uint8_t _tolerance;
+  std::shared_ptr<cache_t> _cache;
+};
+
+}  // namespace autd3::modulation
+
+namespace autd3::driver {
+
+template <class M>
+class IntoModulationAutoSampling {
+ public:
+  IntoModulationAutoSampling() = default;                                                  // LCOV_EXCL_LINE
+  IntoModulationAutoSampling(const IntoModulationAutoSampling& obj) = default;             // LCOV_EXCL_LINE
+  IntoModulationAutoSampling& operator=(const IntoModulationAutoSampling& obj) = default;  // LCOV_EXCL_LINE
+  IntoModulationAutoSampling(IntoModulationAutoSampling&& obj) = default;                  // LCOV_EXCL_LINE
+  IntoModulationAutoSampling& operator=(IntoModulationAutoSampling&& obj) = default;       // LCOV_EXCL_LINE
+  virtual ~IntoModulationAutoSampling() = default;                                         // LCOV_EXCL_LINE
+
+  [[nodiscard]] modulation::AutoSampling<M> with_auto_sampling(const uint8_t tolerance = 0) & {
+    return modulation::AutoSampling(*static_cast<M*>(this), tolerance);
+  }
+  [[nodiscard]] modulation::AutoSampling<M> with_auto_sampling(const uint8_t tolerance = 0) && {
+    return modulation::AutoSampling(std::move(*static_cast<M*>(this)), tolerance);
+  }
+};
+
+}  // namespace autd3::driver
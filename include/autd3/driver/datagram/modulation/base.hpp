@@ -25,7 +25,9 @@ class ModulationBase : public DatagramS<native_methods::ModulationPtr>, public I
    * [autd3::native_methods::FPGA_CLK_FREQ] / (sampling frequency
    * division).
    */
-  [[nodiscard]] SamplingConfiguration sampling_config() const { return SamplingConfiguration(AUTDModulationSamplingConfig(modulation_ptr())); }
+  [[nodiscard]] virtual SamplingConfiguration sampling_config() const {
+    return SamplingConfiguration(AUTDModulationSamplingConfig(modulation_ptr()));
+  }
 
   [[nodiscard]] native_methods::DatagramPtr ptr(const geometry::Geometry&) const { return AUTDModulationIntoDatagram(modulation_ptr()); }
 
@@ -38,7 +40,10 @@ class ModulationBase : public DatagramS<native_methods::ModulationPtr>, public I
   [[nodiscard]] virtual native_methods::ModulationPtr modulation_ptr() const = 0;
   // LCOV_EXCL_STOP
 
-  [[nodiscard]] size_t size() const { return native_methods::validate<size_t>(AUTDModulationSize(modulation_ptr())); }
+  /**
+   * @brief Get the number of modulation data
+   */
+  [[nodiscard]] virtual size_t size() const { return native_methods::validate<size_t>(AUTDModulationSize(modulation_ptr())); }
 
   [[nodiscard]] LoopBehavior loop_behavior() const noexcept { return _loop_behavior; }
 
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <concepts>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "autd3/driver/common/emit_intensity.hpp"
+#include "autd3/driver/common/sampling_config.hpp"
+#include "autd3/native_methods.hpp"
+#include "autd3/native_methods/utils.hpp"
+
+namespace autd3::driver {
+
+/**
+ * @brief Immutable and reference-counted modulation data
+ * @details Copying and slicing the buffer do not copy the data. The data is passed to the native side by pointer.
+ */
+class ModulationBuffer final {
+ public:
+  ModulationBuffer() = default;
+  explicit ModulationBuffer(std::vector<EmitIntensity> data) {
+    auto owner = std::make_shared<const std::vector<EmitIntensity>>(std::move(data));
+    _data = owner->data();
+    _size = owner->size();
+    _owner = std::move(owner);
+  }
+  /**
+   * @brief Constructor
+   *
+   * @param owner Object which owns the data. The data must be alive and not be modified while the owner is alive.
+   * @param data Data
+   */
+  ModulationBuffer(std::shared_ptr<const void> owner, const std::span<const EmitIntensity> data)
+      : _owner(std::move(owner)), _data(data.data()), _size(data.size()) {}
+  ModulationBuffer(const ModulationBuffer& obj) = default;             // LCOV_EXCL_LINE
+  ModulationBuffer& operator=(const ModulationBuffer& obj) = default;  // LCOV_EXCL_LINE
+  ModulationBuffer(ModulationBuffer&& obj) = default;                  // LCOV_EXCL_LINE
+  ModulationBuffer& operator=(ModulationBuffer&& obj) = default;       // LCOV_EXCL_LINE
+  ~ModulationBuffer() = default;                                       // LCOV_EXCL_LINE
+
+  /**
+   * @brief Get a part of the buffer sharing the same data
+   *
+   * @param offset Offset of the first element
+   * @param count Number of elements
+   */
+  [[nodiscard]] ModulationBuffer slice(const size_t offset, const size_t count) const {
+    if (offset > _size || count > _size - offset) throw std::out_of_range("Slice is out of range");
+    return ModulationBuffer(_owner, {_data + offset, count});
+  }
+
+  [[nodiscard]] const EmitIntensity* data() const noexcept { return _data; }
+  [[nodiscard]] size_t size() const noexcept { return _size; }
+  [[nodiscard]] bool empty() const noexcept { return _size == 0; }
+  [[nodiscard]] std::span<const EmitIntensity> span() const noexcept { return {_data, _size}; }
+
+  [[nodiscard]] const EmitIntensity* cbegin() const noexcept { return _data; }
+  [[nodiscard]] const EmitIntensity* cend() const noexcept { return _data + _size; }
+  [[nodiscard]] const EmitIntensity* begin() const noexcept { return _data; }
+  [[nodiscard]] const EmitIntensity* end() const noexcept { return _data + _size; }
+  [[nodiscard]] const EmitIntensity& operator[](const size_t i) const {
+    if (i >= _size) throw std::out_of_range("Index is out of range");
+    return _data[i];
+  }
+
+  /**
+   * @brief Get the number of the owners sharing the data
+   */
+  [[nodiscard]] long use_count() const noexcept { return _owner.use_count(); }
+
+ private:
+  std::shared_ptr<const void> _owner{nullptr};
+  const EmitIntensity* _data{nullptr};
+  size_t _size{0};
+};
+
+/**
+ * @brief Modulation which holds its data in a ModulationBuffer
+ */
+template <class M>
+concept modulation_with_buffer = requires(const M& m) {
+  { m.buffer() } -> std::convertible_to<const ModulationBuffer&>;
+  { m.sampling_config() } -> std::same_as<SamplingConfiguration>;
+};
+
+/**
+ * @brief Calculate the modulation data on the native side
+ * @details If the modulation already holds its data in a ModulationBuffer, the data is copied from it without calculation.
+ *
+ * @param m Modulation
+ * @param f Function to modify the data in place before it is frozen
+ * @return Pair of the modulation data and the sampling configuration
+ */
+template <class M, class F>
+  requires std::invocable<F, std::span<EmitIntensity>>
+[[nodiscard]] std::pair<ModulationBuffer, SamplingConfiguration> calc_modulation(const M& m, F&& f) {
+  if constexpr (modulation_with_buffer<M>) {
+    const auto& buf = m.buffer();
+    std::vector<EmitIntensity> data(buf.begin(), buf.end());
+    std::forward<F>(f)(std::span<EmitIntensity>(data));
+    return {ModulationBuffer(std::move(data)), m.sampling_config()};
+  } else {
+    const auto res = native_methods::AUTDModulationCalc(m.modulation_ptr());
+    const auto ptr = validate(res);
+    std::vector<EmitIntensity> data(res.result_len, EmitIntensity(0));
+    native_methods::AUTDModulationCalcGetResult(ptr, reinterpret_cast<uint8_t*>(data.data()));
+    std::forward<F>(f)(std::span<EmitIntensity>(data));
+    return {ModulationBuffer(std::move(data)), SamplingConfiguration::from_frequency_division(res.freq_div)};
+  }
+}
+
+/**
+ * @brief Calculate the modulation data on the native side
+ *
+ * @return Pair of the modulation data and the sampling configuration
+ */
+template <class M>
+[[nodiscard]] std::pair<ModulationBuffer, SamplingConfiguration> calc_modulation(const M& m) {
+  if constexpr (modulation_with_buffer<M>)
+    return {m.buffer(), m.sampling_config()};
+  else
+    return calc_modulation(m, [](std::span<EmitIntensity>) {});
+}
+
+}  // namespace autd3::driver
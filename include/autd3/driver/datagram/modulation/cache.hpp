@@ -1,58 +1,61 @@
 #pragma once
 
 #include <memory>
+#include <optional>
+#include <utility>
 
 #include "autd3/driver/common/emit_intensity.hpp"
+#include "autd3/driver/common/sampling_config.hpp"
 #include "autd3/driver/datagram/modulation/base.hpp"
+#include "autd3/driver/datagram/modulation/buffer.hpp"
 #include "autd3/native_methods.hpp"
 
 namespace autd3::modulation {
 
 /**
  * @brief Modulation to cache the result of calculation
+ * @details The cached data is shared among the copies of this object and is passed to the native side without copying.
  */
 template <class M>
 class Cache final : public driver::ModulationBase<Cache<M>> {
+  using cache_t = std::optional<std::pair<driver::ModulationBuffer, driver::SamplingConfiguration>>;
+
  public:
-  explicit Cache(M m) : _m(std::move(m)), _cache(std::make_shared<std::vector<driver::EmitIntensity>>()) {}
+  explicit Cache(M m) : _m(std::move(m)), _cache(std::make_shared<cache_t>()) {}
   Cache(const Cache& v) = default;
   Cache& operator=(const Cache& obj) = delete;
   Cache(Cache&& obj) noexcept = default;
   Cache& operator=(Cache&& obj) noexcept = delete;
   ~Cache() noexcept override = default;  // LCOV_EXCL_LINE
 
-  const std::vector<driver::EmitIntensity>& calc() const { return init(); }
+  const driver::ModulationBuffer& calc() const { return init().first; }
 
   [[nodiscard]] native_methods::ModulationPtr modulation_ptr() const override {
-    const auto buf = calc();
-    return AUTDModulationCustom(static_cast<native_methods::SamplingConfiguration>(_sampling_config.value()),
-                                reinterpret_cast<const uint8_t*>(buf.data()), static_cast<uint64_t>(buf.size()),
-                                static_cast<native_methods::LoopBehavior>(_m.loop_behavior()));
+    const auto& [buf, config] = init();
+    return AUTDModulationCustom(static_cast<native_methods::SamplingConfiguration>(config), reinterpret_cast<const uint8_t*>(buf.data()),
+                                static_cast<uint64_t>(buf.size()), static_cast<native_methods::LoopBehavior>(_m.loop_behavior()));
   }
 
-  [[nodiscard]] const std::vector<driver::EmitIntensity>& buffer() const { return *_cache; }
+  [[nodiscard]] const driver::ModulationBuffer& buffer() const { return init().first; }
+
+  [[nodiscard]] driver::SamplingConfiguration sampling_config() const override { return init().second; }
+
+  [[nodiscard]] size_t size() const override { return init().first.size(); }
 
-  [[nodiscard]] std::vector<driver::EmitIntensity>::const_iterator cbegin() const noexcept { return _cache->cbegin(); }
-  [[nodiscard]] std::vector<driver::EmitIntensity>::const_iterator cend() const noexcept { return _cache->cend(); }
-  [[nodiscard]] std::vector<driver::EmitIntensity>::const_iterator begin() const noexcept { return _cache->begin(); }
-  [[nodiscard]] std::vector<driver::EmitIntensity>::const_iterator end() const noexcept { return _cache->end(); }
-  [[nodiscard]] const driver::EmitIntensity& operator[](const size_t i) const { return _cache->at(i); }
+  [[nodiscard]] const driver::EmitIntensity* cbegin() const { return buffer().cbegin(); }
+  [[nodiscard]] const driver::EmitIntensity* cend() const { return buffer().cend(); }
+  [[nodiscard]] const driver::EmitIntensity* begin() const { return buffer().begin(); }
+  [[nodiscard]] const driver::EmitIntensity* end() const { return buffer().end(); }
+  [[nodiscard]] const driver::EmitIntensity& operator[](const size_t i) const { return buffer()[i]; }
 
  private:
-  const std::vector<driver::EmitIntensity>& init() const {
-    if (_cache->size() == 0) {
-      const auto res = native_methods::AUTDModulationCalc(_m.modulation_ptr());
-      const auto ptr = validate(res);
-      _cache->resize(res.result_len, driver::EmitIntensity(0));
-      _sampling_config = driver::SamplingConfiguration::from_frequency_division(res.freq_div);
-      native_methods::AUTDModulationCalcGetResult(ptr, reinterpret_cast<uint8_t*>(_cache->data()));
-    }
-    return *_cache;
+  const std::pair<driver::ModulationBuffer, driver::SamplingConfiguration>& init() const {
+    if (!_cache->has_value()) *_cache = driver::calc_modulation(_m);
+    return _cache->value();
   }
 
   M _m;
-  mutable std::shared_ptr<std::vector<driver::EmitIntensity>> _cache;
-  mutable std::optional<driver::SamplingConfiguration> _sampling_config;
+  std::shared_ptr<cache_t> _cache;
 };
 
 }  // namespace autd3::modulation
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <optional>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "autd3/driver/common/emit_intensity.hpp"
+#include "autd3/driver/common/loop_behavior.hpp"
+#include "autd3/driver/datagram/modulation/base.hpp"
+#include "autd3/driver/datagram/modulation/buffer.hpp"
+#include "autd3/driver/datagram/modulation/cache.hpp"
+#include "autd3/driver/datagram/modulation/radiation_pressure.hpp"
+#include "autd3/native_methods.hpp"
+
+namespace autd3::modulation {
+
+/**
+ * @brief Modulation to send only the shortest period of the result of calculation
+ * @details The period is the shortest prefix whose repetition reproduces the whole data, where each sample may differ by at most the tolerance.
+ * The period is at least 2 samples long. Since sending one period is equivalent only when it is repeated infinitely, the data is compacted only
+ * if the loop behavior is LoopBehavior::infinite(), and is sent as is otherwise. The result is memoized and shared among the copies of this object.
+ */
+template <class M>
+class Compact final : public driver::ModulationBase<Compact<M>>,
+                      public driver::IntoModulationCache<Compact<M>>,
+                      public driver::IntoRadiationPressure<Compact<M>> {
+  using cache_t = std::optional<std::tuple<driver::ModulationBuffer, driver::SamplingConfiguration, size_t>>;
+
+ public:
+  explicit Compact(M m, const uint8_t tolerance = 0) : _m(std::move(m)), _tolerance(tolerance), _cache(std::make_shared<cache_t>()) {
+    this->_loop_behavior = _m.loop_behavior();
+  }
+
+  [[nodiscard]] uint8_t tolerance() const noexcept { return _tolerance; }
+
+  /**
+   * @brief Calculate the modulation data and get its shortest period
+   */
+  [[nodiscard]] driver::ModulationBuffer calc() const { return buffer(); }
+
+  [[nodiscard]] driver::ModulationBuffer buffer() const {
+    const auto& [buf, config, p] = init();
+    return this->_loop_behavior == driver::LoopBehavior::infinite() ? buf.slice(0, p) : buf;
+  }
+
+  [[nodiscard]] driver::SamplingConfiguration sampling_config() const override { return _m.sampling_config(); }
+
+  [[nodiscard]] size_t size() const override { return buffer().size(); }
+
+  [[nodiscard]] native_methods::ModulationPtr modulation_ptr() const override {
+    const auto buf = buffer();
+    const auto config = std::get<1>(init());
+    return AUTDModulationCustom(static_cast<native_methods::SamplingConfiguration>(config), reinterpret_cast<const uint8_t*>(buf.data()),
+                                static_cast<uint64_t>(buf.size()), static_cast<native_methods::LoopBehavior>(this->_loop_behavior));
+  }
+
+  /**
+   * @brief Get the length of the shortest period of the data
+   */
+  [[nodiscard]] static size_t period(const std::span<const driver::EmitIntensity> data, const uint8_t tolerance) {
+    const auto n = data.size();
+    if (n <= 2) return n;
+    if (tolerance == 0) {
+      // the shortest period is n - (length of the longest proper prefix which is also a suffix) if it divides n
+      std::vector<size_t> pi(n, 0);
+      for (size_t i = 1; i < n; i++) {
+        auto k = pi[i - 1];
+        while (k > 0 && data[i] != data[k]) k = pi[k - 1];
+        if (data[i] == data[k]) k++;
+        pi[i] = k;
+      }
+      const auto p = n - pi[n - 1];
+      if (n % p != 0) return n;
+      return p == 1 ? 2 : p;
+    }
+    for (size_t p = 1; p < n; p++) {
+      if (n % p != 0) continue;
+      bool ok = true;
+      for (size_t i = p; i < n && ok; i++) ok = std::abs(static_cast<int>(data[i].value()) - static_cast<int>(data[i % p].value())) <= tolerance;
+      if (ok) return p == 1 ? 2 : p;
+    }
+    return n;
+  }
+
+ private:
+  const std::tuple<driver::ModulationBuffer, driver::SamplingConfiguration, size_t>& init() const {
+    if (!_cache->has_value()) {
+      const auto [buf, config] = driver::calc_modulation(_m);
+      *_cache = std::make_tuple(buf, config, period(buf.span(), _tolerance));
+    }
+    return _cache->value();
+  }
+
+  M _m;
+  uint8_t _tolerance;
+  std::shared_ptr<cache_t> _cache;
+};
+
+}  // namespace autd3::modulation
+
+namespace autd3::driver {
+
+template <class M>
+class IntoModulationCompact {
+ public:
+  [[nodiscard]] modulation::Compact<M> with_compact(const uint8_t tolerance = 0) & { return modulation::Compact(*static_cast<M*>(this), tolerance); }
+  [[nodiscard]] modulation::Compact<M> with_compact(const uint8_t tolerance = 0) && {
+    return modulation::Compact(std::move(*static_cast<M*>(this)), tolerance);
+  }
+};
+
+}  // namespace autd3::driver
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "autd3/driver/common/sampling_config.hpp"
+#include "autd3/driver/datagram/modulation/auto_sampling.hpp"
 #include "autd3/driver/datagram/modulation/base.hpp"
 #include "autd3/driver/datagram/modulation/cache.hpp"
+#include "autd3/driver/datagram/modulation/compact.hpp"
 #include "autd3/driver/datagram/modulation/radiation_pressure.hpp"
 #include "autd3/driver/datagram/modulation/transform.hpp"
 #include "autd3/driver/geometry/geometry.hpp"
@@ -12,13 +14,20 @@
 namespace autd3::driver {
 
 template <class M>
-class Modulation : public ModulationBase<M>, public IntoModulationCache<M>, public IntoRadiationPressure<M>, public IntoModulationTransform<M> {
+class Modulation : public ModulationBase<M>,
+                   public IntoModulationAutoSampling<M>,
+                   public IntoModulationCache<M>,
+                   public IntoModulationCompact<M>,
+                   public IntoRadiationPressure<M>,
+                   public IntoModulationTransform<M> {
  protected:
   SamplingConfiguration _config;
 
   explicit Modulation(const SamplingConfiguration config) : _config(config) {}
 
  public:
+  [[nodiscard]] SamplingConfiguration sampling_config() const override { return _config; }
+
   void with_sampling_config(const SamplingConfiguration config) & { _config = config; }  // LCOV_EXCL_LINE
   [[nodiscard]] M&& with_sampling_config(const SamplingConfiguration config) && {
     _config = config;
@@ -1,21 +1,60 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <span>
+
+#include "autd3/driver/common/emit_intensity.hpp"
 #include "autd3/driver/datagram/modulation/base.hpp"
+#include "autd3/driver/datagram/modulation/buffer.hpp"
 #include "autd3/driver/datagram/modulation/cache.hpp"
 #include "autd3/native_methods.hpp"
 
 namespace autd3::modulation {
 
+namespace radiation_pressure {
+
+/**
+ * @brief Table of `round(sqrt(v / 255) * 255)` for each intensity `v`
+ * @details `round(sqrt(255 v))` is the smallest `k` satisfying `k (k + 1) >= 255 v`, so the table is computed exactly with integers.
+ */
+constexpr std::array<uint8_t, 256> TABLE = [] {
+  std::array<uint8_t, 256> table{};
+  uint32_t k = 0;
+  for (uint32_t v = 0; v < 256; v++) {
+    while (k * (k + 1) < 255 * v) k++;
+    table[v] = static_cast<uint8_t>(k);
+  }
+  return table;
+}();
+
+/**
+ * @brief Convert the intensities in place so that the radiation pressure is proportional to the original intensities
+ */
+inline void apply(const std::span<driver::EmitIntensity> data) noexcept {
+  auto* p = reinterpret_cast<uint8_t*>(data.data());
+  for (size_t i = 0; i < data.size(); i++) p[i] = TABLE[p[i]];
+}
+
+}  // namespace radiation_pressure
+
 /**
  * @brief Modulation for modulating radiation pressure
+ * @details The conversion is done on the C++ side with a lookup table. Use with_cache to convert only once.
  */
 template <class M>
 class RadiationPressure final : public driver::ModulationBase<RadiationPressure<M>>, public driver::IntoModulationCache<RadiationPressure<M>> {
  public:
   explicit RadiationPressure(M m) : _m(std::move(m)) { this->_loop_behavior = _m.loop_behavior(); }
 
+  [[nodiscard]] driver::SamplingConfiguration sampling_config() const override { return _m.sampling_config(); }
+
+  [[nodiscard]] size_t size() const override { return _m.size(); }
+
   [[nodiscard]] native_methods::ModulationPtr modulation_ptr() const override {
-    return native_methods::AUTDModulationWithRadiationPressure(_m.modulation_ptr(), static_cast<native_methods::LoopBehavior>(this->_loop_behavior));
+    const auto [buf, config] = driver::calc_modulation(_m, radiation_pressure::apply);
+    return AUTDModulationCustom(static_cast<native_methods::SamplingConfiguration>(config), reinterpret_cast<const uint8_t*>(buf.data()),
+                                static_cast<uint64_t>(buf.size()), static_cast<native_methods::LoopBehavior>(this->_loop_behavior));
   }
 
  private:
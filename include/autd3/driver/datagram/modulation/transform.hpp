@@ -1,6 +1,9 @@
 #pragma once
 
+#include <span>
+
 #include "autd3/driver/datagram/modulation/base.hpp"
+#include "autd3/driver/datagram/modulation/buffer.hpp"
 #include "autd3/driver/datagram/modulation/radiation_pressure.hpp"
 #include "autd3/driver/datagram/modulation/transform.hpp"
 #include "autd3/native_methods.hpp"
@@ -29,6 +32,10 @@ class Transform final : public driver::ModulationBase<Transform<M, F>>,
     };
   }
 
+  [[nodiscard]] driver::SamplingConfiguration sampling_config() const override { return _m.sampling_config(); }
+
+  [[nodiscard]] size_t size() const override { return _m.size(); }
+
   [[nodiscard]] native_methods::ModulationPtr modulation_ptr() const override {
     return native_methods::AUTDModulationWithTransform(_m.modulation_ptr(), const_cast<void*>(reinterpret_cast<const void*>(_f_native)),
                                                        const_cast<void*>(static_cast<const void*>(this)),
@@ -41,6 +48,37 @@ class Transform final : public driver::ModulationBase<Transform<M, F>>,
   transform_f _f_native;
 };
 
+template <class F>
+concept modulation_transform_bulk_f = requires(F f, std::span<driver::EmitIntensity> data) {
+  { f(data) } -> std::same_as<void>;
+};
+
+/**
+ * @brief Modulation to transform the whole result of calculation at once
+ * @details The data is transformed in place on the C++ side and sent as a custom modulation.
+ */
+template <class M, modulation_transform_bulk_f F>
+class TransformBulk final : public driver::ModulationBase<TransformBulk<M, F>>,
+                            public driver::IntoModulationCache<TransformBulk<M, F>>,
+                            public driver::IntoRadiationPressure<TransformBulk<M, F>> {
+ public:
+  TransformBulk(M m, F f) : _m(std::move(m)), _f(std::move(f)) { this->_loop_behavior = _m.loop_behavior(); }
+
+  [[nodiscard]] driver::SamplingConfiguration sampling_config() const override { return _m.sampling_config(); }
+
+  [[nodiscard]] size_t size() const override { return _m.size(); }
+
+  [[nodiscard]] native_methods::ModulationPtr modulation_ptr() const override {
+    const auto [buf, config] = driver::calc_modulation(_m, _f);
+    return AUTDModulationCustom(static_cast<native_methods::SamplingConfiguration>(config), reinterpret_cast<const uint8_t*>(buf.data()),
+                                static_cast<uint64_t>(buf.size()), static_cast<native_methods::LoopBehavior>(this->_loop_behavior));
+  }
+
+ private:
+  M _m;
+  F _f;
+};
+
 }  // namespace autd3::modulation
 
 namespace autd3::driver {
@@ -56,6 +94,14 @@ class IntoModulationTransform {
   [[nodiscard]] modulation::Transform<M, F> with_transform(F f) && {
     return modulation::Transform(std::move(*static_cast<M*>(this)), std::move(f));
   }
+  template <modulation::modulation_transform_bulk_f F>
+  [[nodiscard]] modulation::TransformBulk<M, F> with_transform_bulk(F f) & {
+    return modulation::TransformBulk(*static_cast<M*>(this), std::move(f));
+  }
+  template <modulation::modulation_transform_bulk_f F>
+  [[nodiscard]] modulation::TransformBulk<M, F> with_transform_bulk(F f) && {
+    return modulation::TransformBulk(std::move(*static_cast<M*>(this)), std::move(f));
+  }
 };
 
 }  // namespace autd3::driver
@@ -1,7 +1,10 @@
 #pragma once
 
 #include <chrono>
+#include <cstring>
 #include <ranges>
+#include <span>
+#include <vector>
 
 #include "autd3/def.hpp"
 #include "autd3/driver/common/emit_intensity.hpp"
@@ -9,6 +12,7 @@
 #include "autd3/driver/datagram/datagram.hpp"
 #include "autd3/driver/datagram/stm/stm.hpp"
 #include "autd3/driver/datagram/with_segment.hpp"
+#include "autd3/exception.hpp"
 #include "autd3/native_methods.hpp"
 
 namespace autd3::driver {
@@ -134,6 +138,7 @@ class FocusSTM final : public STM, public DatagramS<native_methods::FocusSTMPtr>
    */
   template <focus_range_v R>
   void add_foci_from_iter(R&& iter) & {
+    if constexpr (std::ranges::sized_range<R>) reserve(_points.size() + std::ranges::size(iter));
     for (Vector3 e : iter) {
       _points.emplace_back(std::move(e));
       _intensities.emplace_back(EmitIntensity::maximum());
@@ -148,6 +153,7 @@ class FocusSTM final : public STM, public DatagramS<native_methods::FocusSTMPtr>
    */
   template <focus_range_v R>
   [[nodiscard]] FocusSTM add_foci_from_iter(R&& iter) && {
+    if constexpr (std::ranges::sized_range<R>) reserve(_points.size() + std::ranges::size(iter));
     for (Vector3 e : iter) {
       _points.emplace_back(std::move(e));
       _intensities.emplace_back(EmitIntensity::maximum());
@@ -163,6 +169,7 @@ class FocusSTM final : public STM, public DatagramS<native_methods::FocusSTMPtr>
    */
   template <focus_range_c R>
   void add_foci_from_iter(R&& iter) & {
+    if constexpr (std::ranges::sized_range<R>) reserve(_points.size() + std::ranges::size(iter));
     for (ControlPoint e : iter) {
       _points.emplace_back(std::move(e.point));
       _intensities.emplace_back(e.intensity);
@@ -177,6 +184,7 @@ class FocusSTM final : public STM, public DatagramS<native_methods::FocusSTMPtr>
    */
   template <focus_range_c R>
   [[nodiscard]] FocusSTM add_foci_from_iter(R&& iter) && {
+    if constexpr (std::ranges::sized_range<R>) reserve(_points.size() + std::ranges::size(iter));
     for (ControlPoint e : iter) {
       _points.emplace_back(std::move(e.point));
       _intensities.emplace_back(e.intensity);
@@ -184,6 +192,103 @@ class FocusSTM final : public STM, public DatagramS<native_methods::FocusSTMPtr>
     return std::move(*this);
   }
 
+  /**
+   * @brief Reserve the capacity for focus points
+   *
+   * @param n Number of focus points
+   */
+  void reserve(const size_t n) & {
+    _points.reserve(n);
+    _intensities.reserve(n);
+  }
+
+  /**
+   * @brief Reserve the capacity for focus points
+   *
+   * @param n Number of focus points
+   */
+  [[nodiscard]] FocusSTM&& reserve(const size_t n) && {
+    reserve(n);
+    return std::move(*this);
+  }
+
+  /**
+   * @brief Add foci from contiguous memory
+   * @details The data is copied at once without converting each point.
+   *
+   * @param points Coordinates of focus points, where x, y and z of each point are interleaved
+   * @param intensities Emission intensities
+   */
+  void add_foci_from_span(const std::span<const double> points, const std::span<const uint8_t> intensities) & {
+    if (points.size() != 3 * intensities.size()) throw AUTDException("The number of points and intensities must be the same");
+    append_points(points);
+    const auto* p = reinterpret_cast<const EmitIntensity*>(intensities.data());
+    _intensities.insert(_intensities.end(), p, p + intensities.size());
+  }
+
+  /**
+   * @brief Add foci from contiguous memory
+   * @details The data is copied at once without converting each point.
+   *
+   * @param points Coordinates of focus points, where x, y and z of each point are interleaved
+   * @param intensities Emission intensities
+   */
+  [[nodiscard]] FocusSTM add_foci_from_span(const std::span<const double> points, const std::span<const uint8_t> intensities) && {
+    add_foci_from_span(points, intensities);
+    return std::move(*this);
+  }
+
+  /**
+   * @brief Add foci with the maximum intensity from contiguous memory
+   *
+   * @param points Coordinates of focus points, where x, y and z of each point are interleaved
+   */
+  void add_foci_from_span(const std::span<const double> points) & {
+    if (points.size() % 3 != 0) throw AUTDException("The number of coordinates must be a multiple of 3");
+    append_points(points);
+    _intensities.resize(_points.size(), EmitIntensity::maximum());
+  }
+
+  /**
+   * @brief Add foci with the maximum intensity from contiguous memory
+   *
+   * @param points Coordinates of focus points, where x, y and z of each point are interleaved
+   */
+  [[nodiscard]] FocusSTM add_foci_from_span(const std::span<const double> points) && {
+    add_foci_from_span(points);
+    return std::move(*this);
+  }
+
+  /**
+   * @brief Add foci by taking the buffers
+   * @details If no focus has been added, the buffers are adopted without copying.
+   *
+   * @param points Focus points
+   * @param intensities Emission intensities
+   */
+  void add_foci_from_vec(std::vector<Vector3> points, std::vector<EmitIntensity> intensities) & {
+    if (points.size() != intensities.size()) throw AUTDException("The number of points and intensities must be the same");
+    if (_points.empty()) {
+      _points = std::move(points);
+      _intensities = std::move(intensities);
+      return;
+    }
+    _points.insert(_points.end(), points.begin(), points.end());
+    _intensities.insert(_intensities.end(), intensities.begin(), intensities.end());
+  }
+
+  /**
+   * @brief Add foci by taking the buffers
+   * @details If no focus has been added, the buffers are adopted without copying.
+   *
+   * @param points Focus points
+   * @param intensities Emission intensities
+   */
+  [[nodiscard]] FocusSTM add_foci_from_vec(std::vector<Vector3> points, std::vector<EmitIntensity> intensities) && {
+    add_foci_from_vec(std::move(points), std::move(intensities));
+    return std::move(*this);
+  }
+
   [[nodiscard]] double frequency() const { return frequency_from_size(_points.size()); }
   [[nodiscard]] std::chrono::nanoseconds period() const { return period_from_size(_points.size()); }
   [[nodiscard]] SamplingConfiguration sampling_config() const { return sampling_config_from_size(_points.size()); }
@@ -193,6 +298,13 @@ class FocusSTM final : public STM, public DatagramS<native_methods::FocusSTMPtr>
                     const std::optional<SamplingConfiguration> config)
       : STM(freq, period, config) {}
 
+  void append_points(const std::span<const double> points) {
+    static_assert(sizeof(Vector3) == 3 * sizeof(double));
+    const auto n = _points.size();
+    _points.resize(n + points.size() / 3);
+    std::memcpy(reinterpret_cast<double*>(_points.data() + n), points.data(), points.size_bytes());
+  }
+
   std::vector<Vector3> _points;
   std::vector<EmitIntensity> _intensities;
 };
@@ -22,22 +22,28 @@ concept gain_range = std::ranges::viewable_range<R> && gain<std::ranges::range_v
  * - The sampling frequency is
  * [autd3::native_methods::FPGA_CLK_FREQ]/N, where `N` is a 32-bit
  * unsigned integer and must be at least 512.
+ *
+ * If gain types Gs are specified, only these gains can be added and they are stored inline without heap allocation.
+ * Otherwise, any gain can be added.
  */
-class GainSTM final : public STM, public DatagramS<native_methods::GainSTMPtr> {
+template <gain... Gs>
+class BasicGainSTM final : public STM, public DatagramS<native_methods::GainSTMPtr> {
+  using holder = GainHolder<Gs...>;
+
  public:
-  GainSTM() = delete;
-  GainSTM(const GainSTM& obj) = default;
-  GainSTM& operator=(const GainSTM& obj) = default;
-  GainSTM(GainSTM&& obj) = default;
-  GainSTM& operator=(GainSTM&& obj) = default;
-  ~GainSTM() override = default;  // LCOV_EXCL_LINE
+  BasicGainSTM() = delete;
+  BasicGainSTM(const BasicGainSTM& obj) = default;
+  BasicGainSTM& operator=(const BasicGainSTM& obj) = default;
+  BasicGainSTM(BasicGainSTM&& obj) = default;
+  BasicGainSTM& operator=(BasicGainSTM&& obj) = default;
+  ~BasicGainSTM() override = default;  // LCOV_EXCL_LINE
 
   /**
    * @brief Constructor
    *
    * @param freq STM frequency
    */
-  [[nodiscard]] static GainSTM from_freq(const double freq) { return GainSTM(freq, std::nullopt, std::nullopt); }
+  [[nodiscard]] static BasicGainSTM from_freq(const double freq) { return BasicGainSTM(freq, std::nullopt, std::nullopt); }
 
   /**
    * @brief Constructor
@@ -45,18 +51,20 @@ class GainSTM final : public STM, public DatagramS<native_methods::GainSTMPtr> {
    * @param config Sampling configuration
    * @return GainSTM
    */
-  [[nodiscard]] static GainSTM from_sampling_config(const SamplingConfiguration config) { return GainSTM(std::nullopt, std::nullopt, config); }
+  [[nodiscard]] static BasicGainSTM from_sampling_config(const SamplingConfiguration config) {
+    return BasicGainSTM(std::nullopt, std::nullopt, config);
+  }
 
   template <typename Rep, typename Period>
-  [[nodiscard]] static GainSTM from_period(const std::chrono::duration<Rep, Period> period) {
-    return GainSTM(std::nullopt, std::nullopt, std::nullopt, std::chrono::duration_cast<std::chrono::nanoseconds>(period));
+  [[nodiscard]] static BasicGainSTM from_period(const std::chrono::duration<Rep, Period> period) {
+    return BasicGainSTM(std::nullopt, std::chrono::duration_cast<std::chrono::nanoseconds>(period), std::nullopt);
   }
 
   [[nodiscard]] native_methods::GainSTMPtr raw_ptr(const geometry::Geometry& geometry) const override {
     const auto mode = _mode.has_value() ? _mode.value() : native_methods::GainSTMMode::PhaseIntensityFull;
     std::vector<native_methods::GainPtr> gains;
     gains.reserve(_gains.size());
-    std::ranges::transform(_gains, std::back_inserter(gains), [&](const auto& gain) { return gain->gain_ptr(geometry); });
+    std::ranges::transform(_gains, std::back_inserter(gains), [&](const auto& gain) { return holder::gain_ptr(gain, geometry); });
     return validate(AUTDSTMGain(props(), gains.data(), static_cast<uint32_t>(gains.size()), mode));
   }
 
@@ -68,7 +76,7 @@ class GainSTM final : public STM, public DatagramS<native_methods::GainSTMPtr> {
   [[nodiscard]] native_methods::DatagramPtr ptr(const geometry::Geometry& geometry) const { return AUTDSTMGainIntoDatagram(raw_ptr(geometry)); }
 
   [[nodiscard]] DatagramWithSegment<native_methods::GainSTMPtr> with_segment(const native_methods::Segment segment, const bool update_segment) {
-    return DatagramWithSegment<native_methods::GainSTMPtr>(std::make_unique<GainSTM>(std::move(*this)), segment, update_segment);
+    return DatagramWithSegment<native_methods::GainSTMPtr>(std::make_unique<BasicGainSTM>(std::move(*this)), segment, update_segment);
   }
 
   /**
@@ -78,9 +86,9 @@ class GainSTM final : public STM, public DatagramS<native_methods::GainSTMPtr> {
    * @param gain gain
    * @return GainSTM
    */
-  template <gain G>
+  template <gain_of<Gs...> G>
   void add_gain(G&& gain) & {
-    _gains.emplace_back(std::make_shared<std::remove_reference_t<G>>(std::forward<G>(gain)));
+    _gains.emplace_back(holder::make(std::forward<G>(gain)));
   }
 
   /**
@@ -90,9 +98,9 @@ class GainSTM final : public STM, public DatagramS<native_methods::GainSTMPtr> {
    * @param gain gain
    * @return GainSTM
    */
-  template <gain G>
-  [[nodiscard]] GainSTM&& add_gain(G&& gain) && {
-    _gains.emplace_back(std::make_shared<std::remove_reference_t<G>>(std::forward<G>(gain)));
+  template <gain_of<Gs...> G>
+  [[nodiscard]] BasicGainSTM&& add_gain(G&& gain) && {
+    _gains.emplace_back(holder::make(std::forward<G>(gain)));
     return std::move(*this);
   }
 
@@ -103,9 +111,10 @@ class GainSTM final : public STM, public DatagramS<native_methods::GainSTMPtr> {
    * @param iter gain iterator
    */
   template <gain_range R>
+    requires gain_of<std::ranges::range_value_t<R>, Gs...>
   void add_gains_from_iter(R&& iter) & {
-    for (auto e : iter)
-      _gains.emplace_back(std::make_shared<std::remove_reference_t<std::ranges::range_value_t<R>>>(std::forward<std::ranges::range_value_t<R>>(e)));
+    if constexpr (std::ranges::sized_range<R>) _gains.reserve(_gains.size() + std::ranges::size(iter));
+    for (auto e : iter) _gains.emplace_back(holder::make(std::move(e)));
   }
 
   /**
@@ -116,9 +125,9 @@ class GainSTM final : public STM, public DatagramS<native_methods::GainSTMPtr> {
    * @return GainSTM
    */
   template <gain_range R>
-  [[nodiscard]] GainSTM add_gains_from_iter(R&& iter) && {
-    for (auto e : iter)
-      _gains.emplace_back(std::make_shared<std::remove_reference_t<std::ranges::range_value_t<R>>>(std::forward<std::ranges::range_value_t<R>>(e)));
+    requires gain_of<std::ranges::range_value_t<R>, Gs...>
+  [[nodiscard]] BasicGainSTM add_gains_from_iter(R&& iter) && {
+    add_gains_from_iter(std::forward<R>(iter));
     return std::move(*this);
   }
 
@@ -127,20 +136,25 @@ class GainSTM final : public STM, public DatagramS<native_methods::GainSTMPtr> {
   [[nodiscard]] SamplingConfiguration sampling_config() const { return sampling_config_from_size(_gains.size()); }
 
   void with_mode(const native_methods::GainSTMMode mode) & { _mode = mode; }
-  [[nodiscard]] GainSTM&& with_mode(const native_methods::GainSTMMode mode) && {
+  [[nodiscard]] BasicGainSTM&& with_mode(const native_methods::GainSTMMode mode) && {
     _mode = mode;
     return std::move(*this);
   }
 
  private:
-  explicit GainSTM(const std::optional<double> freq, const std::optional<std::chrono::nanoseconds> period,
-                   const std::optional<SamplingConfiguration> config)
+  explicit BasicGainSTM(const std::optional<double> freq, const std::optional<std::chrono::nanoseconds> period,
+                        const std::optional<SamplingConfiguration> config)
       : STM(freq, period, config) {}
 
-  std::vector<std::shared_ptr<GainBase>> _gains;
+  std::vector<typename holder::type> _gains;
   std::optional<native_methods::GainSTMMode> _mode;
 };
 
+/**
+ * @brief GainSTM which can contain any gain
+ */
+using GainSTM = BasicGainSTM<>;
+
 class ChangeGainSTMSegment final {
  public:
   explicit ChangeGainSTMSegment(const native_methods::Segment segment) : _segment(segment){};
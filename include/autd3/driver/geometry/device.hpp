@@ -55,6 +55,12 @@ class Device {
     return v;
   }
 
+  /**
+   * @brief Get rotation of the device
+   * @details All transducers in a device share the rotation of the device.
+   */
+  [[nodiscard]] Quaternion rotation() const { return _transducers.front().rotation(); }
+
   /**
    * @brief Speed of sound
    */
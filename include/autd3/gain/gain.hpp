@@ -4,6 +4,7 @@
 #include <iterator>
 #include <numeric>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "autd3/driver/common/drive.hpp"
@@ -18,6 +19,16 @@ concept gain_transform = requires(F f, const driver::geometry::Device& dev, cons
   { f(dev, tr) } -> std::same_as<driver::Drive>;
 };
 
+template <class F>
+concept gain_transform_rad = requires(F f, const driver::geometry::Device& dev, const driver::geometry::Transducer& tr) {
+  { f(dev, tr) } -> std::same_as<std::pair<double, driver::EmitIntensity>>;
+};
+
+template <class F>
+concept gain_phase_shift = requires(F f, const driver::geometry::Device& ref, const driver::geometry::Device& dev) {
+  { f(ref, dev) } -> std::convertible_to<double>;
+};
+
 template <class G>
 class Gain : public driver::Gain<G> {
  public:
@@ -47,6 +58,49 @@ class Gain : public driver::Gain<G> {
     });
     return drives_map;
   }  // LCOV_EXCL_LINE
+
+  /**
+   * @brief Calculate drives of translation-equivariant gain
+   * @details Enabled devices are grouped by rotation, number of transducers and sound speed. func returns the phase in radian and the intensity,
+   * and is evaluated only for the first device in each group. The phases of the other devices in the group are shifted by shift(first device,
+   * device) in radian before they are quantized, so that the drives are the same as those calculated for each device independently unless the
+   * floating-point error of the sum crosses a quantization boundary. This is valid only if the drives of devices with the same orientation differ
+   * only by a constant phase, e.g., plane waves.
+   */
+  template <gain_transform_rad Fn, gain_phase_shift S>
+  [[nodiscard]] static std::unordered_map<size_t, std::vector<driver::Drive>> transform_equivariant(const driver::geometry::Geometry& geometry,
+                                                                                                   Fn func, S shift) {
+    std::unordered_map<size_t, std::vector<driver::Drive>> drives_map;
+    std::unordered_map<size_t, std::vector<std::pair<double, driver::EmitIntensity>>> raw_map;
+    std::vector<std::pair<const driver::geometry::Device*, driver::Quaternion>> refs;
+    const auto quantize = [](const std::vector<std::pair<double, driver::EmitIntensity>>& raw, const double offset) {
+      std::vector<driver::Drive> drives;
+      drives.reserve(raw.size());
+      std::transform(raw.begin(), raw.end(), std::back_inserter(drives), [offset](const std::pair<double, driver::EmitIntensity>& d) {
+        return driver::Drive{driver::Phase::from_rad(d.first + offset), d.second};
+      });
+      return drives;
+    };
+    std::for_each(geometry.devices().begin(), geometry.devices().end(), [&](const driver::geometry::Device& dev) {
+      const auto rot = dev.rotation();
+      const auto ref = std::find_if(refs.begin(), refs.end(), [&dev, &rot](const auto& r) {
+        return r.first->num_transducers() == dev.num_transducers() && r.first->sound_speed() == dev.sound_speed() &&
+               r.second.angularDistance(rot) < 1e-9;
+      });
+      if (ref == refs.end()) {
+        std::vector<std::pair<double, driver::EmitIntensity>> raw;
+        raw.reserve(dev.num_transducers());
+        std::transform(dev.cbegin(), dev.cend(), std::back_inserter(raw),
+                       [&dev, &func](const driver::geometry::Transducer& tr) { return func(dev, tr); });
+        drives_map[dev.idx()] = quantize(raw, 0.0);
+        raw_map[dev.idx()] = std::move(raw);
+        refs.emplace_back(&dev, rot);
+        return;
+      }
+      drives_map[dev.idx()] = quantize(raw_map[ref->first->idx()], static_cast<double>(shift(*ref->first, dev)));
+    });
+    return drives_map;
+  }  // LCOV_EXCL_LINE
 };
 
 }  // namespace autd3::gain
@@ -17,8 +17,15 @@ concept gain_group_f = requires(F f, const driver::geometry::Device& dev, const
   typename std::invoke_result_t<F, const driver::geometry::Device&, const driver::geometry::Transducer&>::value_type;
 };
 
-template <gain_group_f F>
-class Group final : public driver::Gain<Group<F>> {
+/**
+ * @brief Gain to apply different gains to groups of transducers
+ * @details If gain types Gs are specified, only these gains can be set and they are stored inline without heap allocation.
+ * Otherwise, any gain can be set.
+ */
+template <gain_group_f F, driver::gain... Gs>
+class Group final : public driver::Gain<Group<F, Gs...>> {
+  using holder = driver::GainHolder<Gs...>;
+
  public:
   using key_type = typename std::invoke_result_t<F, const driver::geometry::Device&, const driver::geometry::Transducer&>::value_type;
 
@@ -31,9 +38,9 @@ class Group final : public driver::Gain<Group<F>> {
    * @param key Key
    * @param gain Gain
    */
-  template <driver::gain G>
+  template <driver::gain_of<Gs...> G>
   void set(const key_type key, G&& gain) & {
-    _map[key] = std::make_shared<std::remove_reference_t<G>>(std::forward<G>(gain));
+    _map.insert_or_assign(key, holder::make(std::forward<G>(gain)));
   }
 
   /**
@@ -43,9 +50,9 @@ class Group final : public driver::Gain<Group<F>> {
    * @param key Key
    * @param gain Gain
    */
-  template <driver::gain G>
+  template <driver::gain_of<Gs...> G>
   [[nodiscard]] Group&& set(const key_type key, G&& gain) && {
-    _map[key] = std::make_shared<std::remove_reference_t<G>>(std::forward<G>(gain));
+    _map.insert_or_assign(key, holder::make(std::forward<G>(gain)));
     return std::move(*this);
   }
 
@@ -77,7 +84,7 @@ class Group final : public driver::Gain<Group<F>> {
     for (auto& kv : _map) {
       if (!keymap.contains(kv.first)) throw AUTDException("Unknown group key");
       gain_keys.emplace_back(keymap[kv.first]);
-      gain_ptrs.emplace_back(kv.second->gain_ptr(geometry));
+      gain_ptrs.emplace_back(holder::gain_ptr(kv.second, geometry));
     }
 
     return AUTDGainGroup(map, gain_keys.data(), gain_ptrs.data(), static_cast<uint32_t>(gain_keys.size()));
@@ -85,7 +92,7 @@ class Group final : public driver::Gain<Group<F>> {
 
  private:
   F _f;
-  std::unordered_map<key_type, std::shared_ptr<driver::GainBase>> _map;
+  std::unordered_map<key_type, typename holder::type> _map;
 };
 
 }  // namespace autd3::gain
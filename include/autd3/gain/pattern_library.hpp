@@ -0,0 +1,245 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "autd3/driver/common/drive.hpp"
+#include "autd3/driver/common/mapped_file.hpp"
+#include "autd3/driver/datagram/gain/base.hpp"
+#include "autd3/driver/datagram/with_segment.hpp"
+#include "autd3/driver/geometry/geometry.hpp"
+#include "autd3/exception.hpp"
+#include "autd3/native_methods.hpp"
+#include "autd3/native_methods/utils.hpp"
+
+namespace autd3::gain {
+
+/**
+ * @brief Binary layout of the pattern library
+ * @details All values are stored in the host byte order.
+ * - Header: magic (8 bytes), version (u32), number of patterns (u32), geometry fingerprint (u64), number of devices (u32), reserved (u32)
+ * - Device table: device index (u32) and number of transducers (u32) for each device
+ * - Index: byte offset (u64) of the drive block for each pattern
+ * - Drive blocks: drives of all transducers of the devices in the order of the device table
+ */
+namespace pattern_library {
+constexpr std::string_view MAGIC = "AUTD3GPL";
+constexpr uint32_t VERSION = 1;
+
+struct Header {
+  std::array<char, 8> magic;
+  uint32_t version;
+  uint32_t num_patterns;
+  uint64_t fingerprint;
+  uint32_t num_devices;
+  uint32_t reserved;
+};
+
+struct DeviceEntry {
+  uint32_t idx;
+  uint32_t num_transducers;
+};
+
+/**
+ * @brief Fingerprint of the enabled devices and their transducer positions and rotations
+ */
+[[nodiscard]] inline uint64_t fingerprint(const driver::geometry::Geometry& geometry) {
+  uint64_t hash = 0xcbf29ce484222325;
+  const auto feed = [&hash](const void* data, const size_t len) {
+    const auto* p = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < len; i++) hash = (hash ^ p[i]) * 0x100000001b3;
+  };
+  for (const auto& dev : geometry.devices()) {
+    const DeviceEntry entry{static_cast<uint32_t>(dev.idx()), static_cast<uint32_t>(dev.num_transducers())};
+    feed(&entry, sizeof(DeviceEntry));
+    for (const auto& tr : dev) {
+      const driver::Vector3 pos = tr.position();
+      const driver::Quaternion rot = tr.rotation();
+      const std::array<double, 7> v{pos.x(), pos.y(), pos.z(), rot.w(), rot.x(), rot.y(), rot.z()};
+      feed(v.data(), sizeof(double) * v.size());
+    }
+  }
+  return hash;
+}
+}  // namespace pattern_library
+
+/**
+ * @brief Gain referring to a drive block of a memory-mapped pattern library
+ */
+class Pattern final : public driver::GainBase, public driver::IntoDatagramWithSegment<native_methods::GainPtr, Pattern> {
+ public:
+  Pattern(std::shared_ptr<const driver::MappedFile> file, std::shared_ptr<const std::vector<pattern_library::DeviceEntry>> devices,
+          const driver::Drive* drives)
+      : _file(std::move(file)), _devices(std::move(devices)), _drives(drives) {}
+  Pattern() = delete;                                // LCOV_EXCL_LINE
+  Pattern(const Pattern& obj) = default;             // LCOV_EXCL_LINE
+  Pattern& operator=(const Pattern& obj) = default;  // LCOV_EXCL_LINE
+  Pattern(Pattern&& obj) = default;                  // LCOV_EXCL_LINE
+  Pattern& operator=(Pattern&& obj) = default;       // LCOV_EXCL_LINE
+  ~Pattern() override = default;                     // LCOV_EXCL_LINE
+
+  [[nodiscard]] native_methods::GainPtr gain_ptr(const driver::geometry::Geometry&) const override {
+    auto ptr = native_methods::AUTDGainCustom();
+    const auto* drives = _drives;
+    for (const auto& [idx, num_transducers] : *_devices) {
+      ptr = AUTDGainCustomSet(ptr, idx, reinterpret_cast<const native_methods::Drive*>(drives), num_transducers);
+      drives += num_transducers;
+    }
+    return ptr;
+  }
+
+  /**
+   * @brief Get drives of the device
+   */
+  [[nodiscard]] std::span<const driver::Drive> operator[](const driver::geometry::Device& dev) const {
+    const auto* drives = _drives;
+    for (const auto& [idx, num_transducers] : *_devices) {
+      if (idx == dev.idx()) return {drives, num_transducers};
+      drives += num_transducers;
+    }
+    throw AUTDException("Device is not in the pattern library");
+  }
+
+ private:
+  std::shared_ptr<const driver::MappedFile> _file;
+  std::shared_ptr<const std::vector<pattern_library::DeviceEntry>> _devices;
+  const driver::Drive* _drives;
+};
+
+/**
+ * @brief Writer of the pattern library
+ */
+class PatternLibraryWriter final {
+ public:
+  explicit PatternLibraryWriter(const driver::geometry::Geometry& geometry) : _geometry(geometry) {}
+
+  /**
+   * @brief Calculate the gain and add its drives to the library
+   */
+  void add(const driver::GainBase& gain) & {
+    const auto res = validate(native_methods::AUTDGainCalc(gain.gain_ptr(_geometry), _geometry.ptr()));
+    for (const auto& dev : _geometry.devices()) {
+      const auto offset = _drives.size();
+      _drives.resize(offset + dev.num_transducers(), driver::Drive{driver::Phase(0), 0});
+      native_methods::AUTDGainCalcGetResult(res, reinterpret_cast<native_methods::Drive*>(_drives.data() + offset), static_cast<uint32_t>(dev.idx()));
+    }
+    native_methods::AUTDGainCalcFreeResult(res);
+    _num_patterns++;
+  }
+
+  /**
+   * @brief Calculate the gain and add its drives to the library
+   */
+  [[nodiscard]] PatternLibraryWriter&& add(const driver::GainBase& gain) && {
+    add(gain);
+    return std::move(*this);
+  }
+
+  /**
+   * @brief Write the library to the file
+   */
+  void write(const std::filesystem::path& path) const {
+    std::vector<pattern_library::DeviceEntry> devices;
+    std::ranges::transform(_geometry.devices(), std::back_inserter(devices), [](const driver::geometry::Device& dev) {
+      return pattern_library::DeviceEntry{static_cast<uint32_t>(dev.idx()), static_cast<uint32_t>(dev.num_transducers())};
+    });
+    const auto block_size = sizeof(driver::Drive) * std::accumulate(devices.begin(), devices.end(), size_t{0}, [](const size_t acc, const auto& d) {
+                              return acc + d.num_transducers;
+                            });
+
+    pattern_library::Header header{};
+    std::ranges::copy(pattern_library::MAGIC, header.magic.begin());
+    header.version = pattern_library::VERSION;
+    header.num_patterns = _num_patterns;
+    header.fingerprint = pattern_library::fingerprint(_geometry);
+    header.num_devices = static_cast<uint32_t>(devices.size());
+
+    const auto data_offset =
+        sizeof(pattern_library::Header) + sizeof(pattern_library::DeviceEntry) * devices.size() + sizeof(uint64_t) * _num_patterns;
+    std::vector<uint64_t> index(_num_patterns);
+    for (size_t i = 0; i < index.size(); i++) index[i] = static_cast<uint64_t>(data_offset + block_size * i);
+
+    std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+    if (!ofs) throw AUTDException("Failed to open " + path.string());
+    ofs.write(reinterpret_cast<const char*>(&header), sizeof(pattern_library::Header));
+    ofs.write(reinterpret_cast<const char*>(devices.data()), static_cast<std::streamsize>(sizeof(pattern_library::DeviceEntry) * devices.size()));
+    ofs.write(reinterpret_cast<const char*>(index.data()), static_cast<std::streamsize>(sizeof(uint64_t) * index.size()));
+    ofs.write(reinterpret_cast<const char*>(_drives.data()), static_cast<std::streamsize>(sizeof(driver::Drive) * _drives.size()));
+    if (!ofs) throw AUTDException("Failed to write " + path.string());
+  }
+
+ private:
+  const driver::geometry::Geometry& _geometry;
+  std::vector<driver::Drive> _drives;
+  uint32_t _num_patterns{0};
+};
+
+/**
+ * @brief Pattern library loaded by memory mapping
+ * @details The drives are passed to the native side directly from the mapped memory without any calculation.
+ */
+class PatternLibrary final {
+ public:
+  /**
+   * @brief Open the pattern library
+   *
+   * @param path Path to the library
+   * @param geometry Geometry which must be the same as that used to write the library
+   */
+  [[nodiscard]] static PatternLibrary open(const std::filesystem::path& path, const driver::geometry::Geometry& geometry) {
+    auto file = std::make_shared<const driver::MappedFile>(path);
+    const auto bytes = file->bytes();
+
+    pattern_library::Header header{};
+    if (bytes.size() < sizeof(pattern_library::Header)) throw AUTDException("Invalid pattern library");
+    std::memcpy(&header, bytes.data(), sizeof(pattern_library::Header));
+    if (!std::ranges::equal(header.magic, pattern_library::MAGIC)) throw AUTDException("Invalid pattern library");
+    if (header.version != pattern_library::VERSION) throw AUTDException("Unsupported pattern library version");
+    if (header.fingerprint != pattern_library::fingerprint(geometry)) throw AUTDException("Geometry does not match the pattern library");
+
+    auto devices = std::make_shared<std::vector<pattern_library::DeviceEntry>>(header.num_devices);
+    const auto devices_offset = sizeof(pattern_library::Header);
+    const auto index_offset = devices_offset + sizeof(pattern_library::DeviceEntry) * header.num_devices;
+    if (bytes.size() < index_offset + sizeof(uint64_t) * header.num_patterns) throw AUTDException("Invalid pattern library");
+    std::memcpy(devices->data(), bytes.data() + devices_offset, sizeof(pattern_library::DeviceEntry) * header.num_devices);
+    std::vector<uint64_t> index(header.num_patterns);
+    std::memcpy(index.data(), bytes.data() + index_offset, sizeof(uint64_t) * header.num_patterns);
+
+    const auto block_size = sizeof(driver::Drive) * std::accumulate(devices->begin(), devices->end(), size_t{0}, [](const size_t acc, const auto& d) {
+                              return acc + d.num_transducers;
+                            });
+    if (std::ranges::any_of(index, [&](const uint64_t offset) { return offset + block_size > bytes.size(); }))
+      throw AUTDException("Invalid pattern library");
+
+    return PatternLibrary(std::move(file), std::move(devices), std::move(index));
+  }
+
+  /**
+   * @brief Get the number of patterns
+   */
+  [[nodiscard]] size_t size() const noexcept { return _index.size(); }
+
+  [[nodiscard]] Pattern operator[](const size_t i) const {
+    return Pattern(_file, _devices, reinterpret_cast<const driver::Drive*>(_file->data() + _index.at(i)));
+  }
+
+ private:
+  PatternLibrary(std::shared_ptr<const driver::MappedFile> file, std::shared_ptr<const std::vector<pattern_library::DeviceEntry>> devices,
+                 std::vector<uint64_t> index)
+      : _file(std::move(file)), _devices(std::move(devices)), _index(std::move(index)) {}
+
+  std::shared_ptr<const driver::MappedFile> _file;
+  std::shared_ptr<const std::vector<pattern_library::DeviceEntry>> _devices;
+  std::vector<uint64_t> _index;
+};
+
+}  // namespace autd3::gain
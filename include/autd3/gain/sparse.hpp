@@ -0,0 +1,102 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "autd3/def.hpp"
+#include "autd3/driver/common/drive.hpp"
+#include "autd3/driver/common/emit_intensity.hpp"
+#include "autd3/driver/common/phase.hpp"
+#include "autd3/driver/datagram/gain/gain.hpp"
+#include "autd3/driver/geometry/geometry.hpp"
+#include "autd3/exception.hpp"
+#include "autd3/native_methods.hpp"
+
+namespace autd3::gain {
+
+/**
+ * @brief Gain to drive only a few transducers
+ * @details Only the drives of the specified transducers are stored. The other transducers are driven by the default drive, which is expanded only
+ * when the gain is passed to the native side.
+ */
+class Sparse final : public driver::Gain<Sparse> {
+ public:
+  Sparse() : _default_drive(driver::Phase(0), driver::EmitIntensity::minimum()) {}
+  explicit Sparse(const driver::Drive default_drive) : _default_drive(default_drive) {}
+  Sparse(const Sparse& obj) = default;
+  Sparse& operator=(const Sparse& obj) = default;
+  Sparse(Sparse&& obj) = default;
+  Sparse& operator=(Sparse&& obj) = default;
+  ~Sparse() override = default;  // LCOV_EXCL_LINE
+
+  AUTD3_DEF_PARAM(Sparse, driver::Drive, default_drive)
+
+  /**
+   * @brief Set drive of the transducer
+   * @details If the transducer has already been set, its drive is overwritten.
+   *
+   * @param dev_idx Device index
+   * @param tr_idx Local transducer index
+   * @param drive Drive
+   */
+  void set(const size_t dev_idx, const size_t tr_idx, const driver::Drive drive) & {
+    _drives[dev_idx].insert_or_assign(static_cast<uint32_t>(tr_idx), drive);
+  }
+
+  /**
+   * @brief Set drive of the transducer
+   * @details If the transducer has already been set, its drive is overwritten.
+   *
+   * @param dev_idx Device index
+   * @param tr_idx Local transducer index
+   * @param drive Drive
+   */
+  [[nodiscard]] Sparse&& set(const size_t dev_idx, const size_t tr_idx, const driver::Drive drive) && {
+    _drives[dev_idx].insert_or_assign(static_cast<uint32_t>(tr_idx), drive);
+    return std::move(*this);
+  }
+
+  void set(const driver::geometry::Device& dev, const driver::geometry::Transducer& tr, const driver::Drive drive) & {
+    set(dev.idx(), tr.idx(), drive);
+  }
+
+  [[nodiscard]] Sparse&& set(const driver::geometry::Device& dev, const driver::geometry::Transducer& tr, const driver::Drive drive) && {
+    set(dev.idx(), tr.idx(), drive);
+    return std::move(*this);
+  }
+
+  /**
+   * @brief Get the number of stored drives
+   */
+  [[nodiscard]] size_t size() const {
+    return std::accumulate(_drives.begin(), _drives.end(), size_t{0}, [](const size_t acc, const auto& kv) { return acc + kv.second.size(); });
+  }
+
+  [[nodiscard]] native_methods::GainPtr gain_ptr(const driver::geometry::Geometry& geometry) const override {
+    // validate before AUTDGainCustom so that the native gain is not leaked on error
+    for (const auto& dev : geometry.devices())
+      if (const auto it = _drives.find(dev.idx());
+          it != _drives.end() && std::ranges::any_of(it->second, [&dev](const auto& kv) { return kv.first >= dev.num_transducers(); }))
+        throw AUTDException("Transducer index out of range");
+    return std::accumulate(geometry.devices().begin(), geometry.devices().end(), native_methods::AUTDGainCustom(),
+                           [this](const native_methods::GainPtr acc, const driver::geometry::Device& dev) {
+                             std::vector<driver::Drive> drives(dev.num_transducers(), _default_drive);
+                             if (const auto it = _drives.find(dev.idx()); it != _drives.end()) {
+                               std::ranges::for_each(it->second, [&drives](const auto& kv) { drives[kv.first] = kv.second; });
+                             }
+                             return AUTDGainCustomSet(acc, static_cast<uint32_t>(dev.idx()),
+                                                      reinterpret_cast<const native_methods::Drive*>(drives.data()),
+                                                      static_cast<uint32_t>(drives.size()));
+                           });
+  }
+
+ private:
+  std::unordered_map<size_t, std::map<uint32_t, driver::Drive>> _drives;
+};
+
+}  // namespace autd3::gain
@@ -1,4 +1,8 @@
 #pragma once
 
+#include "autd3/modulation/audio_file/mapped_raw_pcm.hpp"
+#include "autd3/modulation/audio_file/multi_channel_wav.hpp"
 #include "autd3/modulation/audio_file/raw_pcm.hpp"
+#include "autd3/modulation/audio_file/stream.hpp"
 #include "autd3/modulation/audio_file/wav.hpp"
+#include "autd3/modulation/audio_file/wav_reader.hpp"
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "autd3/driver/common/emit_intensity.hpp"
+#include "autd3/driver/common/mapped_file.hpp"
+#include "autd3/driver/common/sampling_config.hpp"
+#include "autd3/modulation/modulation.hpp"
+#include "autd3/modulation/resampler.hpp"
+
+namespace autd3::modulation::audio_file {
+
+/**
+ * @brief Modulation constructed from memory-mapped raw pcm file
+ * @details The file must consist of unsigned 8-bit samples. Only the selected range of the file is read and re-sampled to the sampling frequency
+ * of Modulation. Slicing shares the mapping and does not copy the file.
+ */
+class MappedRawPCM final : public Modulation<MappedRawPCM> {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param path Path to raw pcm file
+   * @param sample_rate Sampling frequency of raw pcm file
+   */
+  MappedRawPCM(const std::filesystem::path& path, const uint32_t sample_rate)
+      : Modulation(driver::SamplingConfiguration::from_frequency(4e3)),
+        _file(std::make_shared<const driver::MappedFile>(path)),
+        _sample_rate(sample_rate),
+        _offset(0),
+        _length(_file->size()) {}
+
+  /**
+   * @brief Get a part of the file
+   *
+   * @param offset Offset in samples from the beginning of this range
+   * @param length Number of samples
+   */
+  [[nodiscard]] MappedRawPCM slice(const size_t offset, const size_t length) const {
+    if (offset > _length || length > _length - offset) throw std::out_of_range("Slice is out of range");
+    auto m = *this;
+    m._offset = _offset + offset;
+    m._length = length;
+    m._size.reset();
+    return m;
+  }
+
+  [[nodiscard]] uint32_t sample_rate() const noexcept { return _sample_rate; }
+  [[nodiscard]] size_t offset() const noexcept { return _offset; }
+  [[nodiscard]] size_t length() const noexcept { return _length; }
+
+  [[nodiscard]] std::vector<driver::EmitIntensity> calc() const override {
+    std::vector<double> in(_length);
+    std::ranges::transform(_file->bytes().subspan(_offset, _length), in.begin(), [](const uint8_t v) { return static_cast<double>(v); });
+    const auto out = PolyphaseResampler(_sample_rate, _config).resample(in);
+    std::vector<driver::EmitIntensity> buffer;
+    buffer.reserve(out.size());
+    std::ranges::transform(out, std::back_inserter(buffer),
+                           [](const double v) { return driver::EmitIntensity(static_cast<uint8_t>(std::round(std::clamp(v, 0.0, 255.0)))); });
+    return buffer;
+  }
+
+  /**
+   * @brief Get the number of modulation data
+   * @details The selected range is re-sampled only when the sampling configuration has changed since the last call.
+   */
+  [[nodiscard]] size_t size() const override {
+    if (!_size.has_value() || _size->first != _config.frequency_division()) _size = std::make_pair(_config.frequency_division(), calc().size());
+    return _size->second;
+  }
+
+ private:
+  std::shared_ptr<const driver::MappedFile> _file;
+  uint32_t _sample_rate;
+  size_t _offset;
+  size_t _length;
+  mutable std::optional<std::pair<uint32_t, size_t>> _size;
+};
+
+}  // namespace autd3::modulation::audio_file
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "autd3/driver/common/emit_intensity.hpp"
+#include "autd3/driver/common/sampling_config.hpp"
+#include "autd3/driver/datagram/modulation/buffer.hpp"
+#include "autd3/modulation/audio_file/wav_reader.hpp"
+#include "autd3/modulation/custom.hpp"
+#include "autd3/modulation/resampler.hpp"
+
+namespace autd3::modulation::audio_file {
+
+/**
+ * @brief Modulations constructed from each channel of wav file
+ * @details The file is decoded once, and all channels are re-sampled to the sampling frequency with the same filter. The data of all channels is
+ * held in one shared buffer, and each channel is obtained as a Custom modulation without copying, e.g., to send different channels to different
+ * devices with Controller::group.
+ */
+class MultiChannelWav final {
+ public:
+  static constexpr size_t BLOCK_FRAMES = 4096;
+
+  /**
+   * @brief Constructor
+   *
+   * @param path Path to wav file
+   * @param config Sampling configuration of the modulations
+   */
+  explicit MultiChannelWav(const std::filesystem::path& path,
+                           const driver::SamplingConfiguration config = driver::SamplingConfiguration::from_frequency(4e3))
+      : _config(config) {
+    WavReader reader(path);
+    const size_t channels = reader.channels();
+
+    std::vector<std::vector<double>> planar(channels);
+    std::ranges::for_each(planar, [&reader](auto& v) { v.reserve(reader.num_frames()); });
+    std::vector<double> block(BLOCK_FRAMES * channels);
+    while (const auto frames = reader.read(block)) {
+      for (size_t f = 0; f < frames; f++)
+        for (size_t c = 0; c < channels; c++) planar[c].emplace_back(block[f * channels + c]);
+    }
+
+    PolyphaseResampler resampler(reader.sample_rate(), config);
+    std::vector<driver::EmitIntensity> data;
+    size_t len = 0;
+    for (const auto& in : planar) {
+      const auto out = resampler.resample(in);
+      len = out.size();
+      data.reserve(len * channels);
+      std::ranges::transform(out, std::back_inserter(data),
+                             [](const double x) { return driver::EmitIntensity(static_cast<uint8_t>(std::round(std::clamp(x, 0.0, 1.0) * 255.0))); });
+    }
+
+    const auto owner = std::make_shared<const std::vector<driver::EmitIntensity>>(std::move(data));
+    _channels.reserve(channels);
+    for (size_t c = 0; c < channels; c++) _channels.emplace_back(owner, std::span(owner->data() + c * len, len));
+  }
+
+  [[nodiscard]] size_t channels() const noexcept { return _channels.size(); }
+  [[nodiscard]] driver::SamplingConfiguration sampling_config() const noexcept { return _config; }
+
+  /**
+   * @brief Get the data of the channel
+   */
+  [[nodiscard]] const driver::ModulationBuffer& buffer(const size_t channel) const { return _channels.at(channel); }
+
+  /**
+   * @brief Get the channel as a modulation without copying the data
+   */
+  [[nodiscard]] Custom operator[](const size_t channel) const { return Custom(_channels.at(channel), _config); }
+
+ private:
+  driver::SamplingConfiguration _config;
+  std::vector<driver::ModulationBuffer> _channels;
+};
+
+}  // namespace autd3::modulation::audio_file
@@ -2,6 +2,8 @@
 
 #include <chrono>
 #include <filesystem>
+#include <optional>
+#include <utility>
 
 #include "autd3/driver/datagram/modulation/modulation.hpp"
 #include "autd3/native_methods.hpp"
@@ -24,6 +26,16 @@ class RawPCM final : public driver::Modulation<RawPCM> {
   explicit RawPCM(std::filesystem::path path, const uint32_t sample_rate)
       : Modulation(driver::SamplingConfiguration::from_frequency(4e3)), _sample_rate(sample_rate), _path(std::move(path)) {}
 
+  /**
+   * @brief Get the number of modulation data
+   * @details The file is decoded only when the sampling configuration has changed since the last call.
+   */
+  [[nodiscard]] size_t size() const override {
+    if (!_size.has_value() || _size->first != _config.frequency_division())
+      _size = std::make_pair(_config.frequency_division(), driver::ModulationBase<RawPCM>::size());
+    return _size->second;
+  }
+
   [[nodiscard]] native_methods::ModulationPtr modulation_ptr() const override {
     return validate(AUTDModulationRawPCM(_path.string().c_str(), _sample_rate, static_cast<native_methods::SamplingConfiguration>(_config),
                                          static_cast<native_methods::LoopBehavior>(_loop_behavior)));
@@ -32,6 +44,7 @@ class RawPCM final : public driver::Modulation<RawPCM> {
  private:
   uint32_t _sample_rate;
   std::filesystem::path _path;
+  mutable std::optional<std::pair<uint32_t, size_t>> _size;
 };
 
 }  // namespace autd3::modulation::audio_file
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+#include "autd3/driver/common/emit_intensity.hpp"
+#include "autd3/driver/common/sampling_config.hpp"
+#include "autd3/driver/datagram/modulation/buffer.hpp"
+#include "autd3/exception.hpp"
+#include "autd3/modulation/audio_file/wav_reader.hpp"
+#include "autd3/modulation/resampler.hpp"
+#include "autd3/modulation/stream.hpp"
+
+namespace autd3::modulation::audio_file {
+
+/**
+ * @brief Source decoding and re-sampling wav file chunk by chunk
+ * @details Use with autd3::modulation::stream to play a wav file of arbitrary length with bounded memory.
+ */
+class WavStream final {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param path Path to wav file
+   * @param chunk_size Number of samples of each chunk after re-sampling, which must be at least 2 and not exceed the modulation buffer size of
+   * the device
+   * @param config Sampling configuration of the chunks
+   */
+  WavStream(const std::filesystem::path& path, const size_t chunk_size,
+            const driver::SamplingConfiguration config = driver::SamplingConfiguration::from_frequency(4e3))
+      : _reader(path), _resampler(_reader.sample_rate(), config), _chunk_size(chunk_size), _config(config) {
+    if (chunk_size < 2) throw AUTDException("Chunk size must be at least 2");
+  }
+
+  [[nodiscard]] driver::SamplingConfiguration sampling_config() const noexcept { return _config; }
+
+  /**
+   * @brief Get the next chunk
+   *
+   * @return Next chunk, or std::nullopt if the end of file has been reached
+   */
+  [[nodiscard]] std::optional<driver::ModulationBuffer> next() {
+    while (_pending.size() - _offset < _chunk_size && !_flushed) {
+      _in.resize(_chunk_size);
+      if (const auto n = _reader.read_mono(_in); n > 0) {
+        _resampler.process(std::span(_in.data(), n), _pending);
+      } else {
+        _resampler.flush(_pending);
+        _flushed = true;
+      }
+    }
+    const auto n = std::min(_chunk_size, _pending.size() - _offset);
+    if (n == 0) return std::nullopt;
+    std::vector<driver::EmitIntensity> chunk;
+    chunk.reserve(std::max<size_t>(n, 2));
+    std::ranges::transform(_pending.begin() + static_cast<std::ptrdiff_t>(_offset), _pending.begin() + static_cast<std::ptrdiff_t>(_offset + n),
+                           std::back_inserter(chunk),
+                           [](const double x) { return driver::EmitIntensity(static_cast<uint8_t>(std::round(std::clamp(x, 0.0, 1.0) * 255.0))); });
+    if (chunk.size() == 1) chunk.emplace_back(chunk.front());
+    _offset += n;
+    if (_offset * 2 >= _pending.size()) {
+      _pending.erase(_pending.begin(), _pending.begin() + static_cast<std::ptrdiff_t>(_offset));
+      _offset = 0;
+    }
+    return driver::ModulationBuffer(std::move(chunk));
+  }
+
+ private:
+  WavReader _reader;
+  PolyphaseResampler _resampler;
+  size_t _chunk_size;
+  driver::SamplingConfiguration _config;
+  std::vector<double> _in;
+  std::vector<double> _pending;
+  size_t _offset{0};
+  bool _flushed{false};
+};
+
+}  // namespace autd3::modulation::audio_file
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "autd3/exception.hpp"
+
+namespace autd3::modulation::audio_file {
+
+/**
+ * @brief Reader of wav file decoding the samples chunk by chunk
+ * @details Linear PCM of 8, 16, 24 and 32 bits and IEEE float of 32 bits are supported. The samples are normalized to [0, 1], where 0.5 is the
+ * silence.
+ */
+class WavReader final {
+ public:
+  explicit WavReader(const std::filesystem::path& path) : _ifs(path, std::ios::binary) {
+    if (!_ifs) throw AUTDException("Failed to open " + path.string());
+
+    std::array<char, 12> riff{};
+    if (!_ifs.read(riff.data(), riff.size()) || std::string_view(riff.data(), 4) != "RIFF" || std::string_view(riff.data() + 8, 4) != "WAVE")
+      throw AUTDException("Invalid wav file: " + path.string());
+
+    bool has_fmt = false;
+    for (;;) {
+      std::array<char, 8> header{};
+      if (!_ifs.read(header.data(), header.size())) throw AUTDException("Invalid wav file: " + path.string());
+      const std::string_view id(header.data(), 4);
+      const auto size = read_le(reinterpret_cast<const uint8_t*>(header.data()) + 4, 4);
+      if (id == "fmt ") {
+        std::vector<uint8_t> fmt(size);
+        if (size < 16 || !_ifs.read(reinterpret_cast<char*>(fmt.data()), static_cast<std::streamsize>(size)))
+          throw AUTDException("Invalid wav file: " + path.string());
+        auto tag = static_cast<uint16_t>(read_le(fmt.data(), 2));
+        if (tag == 0xFFFE && size >= 26) tag = static_cast<uint16_t>(read_le(fmt.data() + 24, 2));
+        _channels = static_cast<uint16_t>(read_le(fmt.data() + 2, 2));
+        _sample_rate = read_le(fmt.data() + 4, 4);
+        _bits_per_sample = static_cast<uint16_t>(read_le(fmt.data() + 14, 2));
+        _is_float = tag == 3;
+        if ((tag != 1 && tag != 3) || (_is_float && _bits_per_sample != 32) || (!_is_float && _bits_per_sample % 8 != 0) || _bits_per_sample == 0 ||
+            _bits_per_sample > 32 || _channels == 0)
+          throw AUTDException("Unsupported wav format: " + path.string());
+        if (size % 2 == 1) _ifs.ignore(1);
+        has_fmt = true;
+      } else if (id == "data") {
+        if (!has_fmt) throw AUTDException("Invalid wav file: " + path.string());
+        _num_frames = size / (_bits_per_sample / 8 * _channels);
+        break;
+      } else {
+        _ifs.ignore(static_cast<std::streamsize>(size + size % 2));
+      }
+    }
+    _data_offset = _ifs.tellg();
+  }
+
+  [[nodiscard]] uint16_t channels() const noexcept { return _channels; }
+  [[nodiscard]] uint32_t sample_rate() const noexcept { return _sample_rate; }
+  [[nodiscard]] uint16_t bits_per_sample() const noexcept { return _bits_per_sample; }
+  [[nodiscard]] size_t num_frames() const noexcept { return _num_frames; }
+  [[nodiscard]] size_t position() const noexcept { return _position; }
+
+  /**
+   * @brief Seek to the frame
+   */
+  void seek(const size_t frame) {
+    _position = std::min(frame, _num_frames);
+    _ifs.clear();
+    _ifs.seekg(_data_offset + static_cast<std::streamoff>(_position * bytes_per_frame()));
+  }
+
+  /**
+   * @brief Read interleaved samples
+   *
+   * @param dst Destination whose size is a multiple of the number of channels
+   * @return Number of frames read, which is less than requested only at the end of the file
+   */
+  size_t read(const std::span<double> dst) {
+    const auto frames = std::min(dst.size() / _channels, _num_frames - _position);
+    _raw.resize(frames * bytes_per_frame());
+    if (!_ifs.read(reinterpret_cast<char*>(_raw.data()), static_cast<std::streamsize>(_raw.size()))) throw AUTDException("Failed to read wav file");
+    const auto bytes = _bits_per_sample / 8;
+    for (size_t i = 0; i < frames * _channels; i++) dst[i] = decode(_raw.data() + i * bytes);
+    _position += frames;
+    return frames;
+  }
+
+  /**
+   * @brief Read samples averaged over the channels
+   *
+   * @param dst Destination
+   * @return Number of frames read, which is less than requested only at the end of the file
+   */
+  size_t read_mono(const std::span<double> dst) {
+    if (_channels == 1) return read(dst);
+    _interleaved.resize(dst.size() * _channels);
+    const auto frames = read(_interleaved);
+    for (size_t i = 0; i < frames; i++) {
+      double sum = 0.0;
+      for (size_t c = 0; c < _channels; c++) sum += _interleaved[i * _channels + c];
+      dst[i] = sum / static_cast<double>(_channels);
+    }
+    return frames;
+  }
+
+ private:
+  [[nodiscard]] static uint32_t read_le(const uint8_t* p, const size_t n) {
+    uint32_t v = 0;
+    for (size_t i = 0; i < n; i++) v |= static_cast<uint32_t>(p[i]) << (8 * i);
+    return v;
+  }
+
+  [[nodiscard]] size_t bytes_per_frame() const noexcept { return static_cast<size_t>(_bits_per_sample / 8) * _channels; }
+
+  [[nodiscard]] double decode(const uint8_t* p) const {
+    if (_is_float) {
+      const auto v = read_le(p, 4);
+      float f;
+      std::memcpy(&f, &v, sizeof(float));
+      return std::clamp((static_cast<double>(f) + 1.0) / 2.0, 0.0, 1.0);
+    }
+    if (_bits_per_sample == 8) return static_cast<double>(p[0]) / 255.0;
+    const auto shift = 32 - _bits_per_sample;
+    const auto v = static_cast<int32_t>(read_le(p, _bits_per_sample / 8) << shift) >> shift;
+    const auto max = static_cast<double>((int64_t{1} << (_bits_per_sample - 1)) - 1);
+    return (static_cast<double>(v) + max + 1.0) / (2.0 * max + 1.0);
+  }
+
+  std::ifstream _ifs;
+  std::streampos _data_offset;
+  uint16_t _channels{0};
+  uint32_t _sample_rate{0};
+  uint16_t _bits_per_sample{0};
+  bool _is_float{false};
+  size_t _num_frames{0};
+  size_t _position{0};
+  std::vector<uint8_t> _raw;
+  std::vector<double> _interleaved;
+};
+
+}  // namespace autd3::modulation::audio_file
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <utility>
+
+#include "autd3/driver/common/sampling_config.hpp"
+#include "autd3/driver/datagram/modulation/buffer.hpp"
+#include "autd3/driver/datagram/modulation/modulation.hpp"
+#include "autd3/native_methods.hpp"
+
+namespace autd3::modulation {
+
+/**
+ * @brief Modulation to send the shared modulation data as it is
+ * @details The data is passed to the native side without copying.
+ */
+class Custom final : public driver::Modulation<Custom> {
+ public:
+  Custom(driver::ModulationBuffer buffer, const driver::SamplingConfiguration config) : Modulation(config), _buffer(std::move(buffer)) {}
+  Custom() = delete;                               // LCOV_EXCL_LINE
+  Custom(const Custom& obj) = default;             // LCOV_EXCL_LINE
+  Custom& operator=(const Custom& obj) = default;  // LCOV_EXCL_LINE
+  Custom(Custom&& obj) = default;                  // LCOV_EXCL_LINE
+  Custom& operator=(Custom&& obj) = default;       // LCOV_EXCL_LINE
+  ~Custom() override = default;                    // LCOV_EXCL_LINE
+
+  [[nodiscard]] const driver::ModulationBuffer& buffer() const noexcept { return _buffer; }
+
+  [[nodiscard]] size_t size() const override { return _buffer.size(); }
+
+  [[nodiscard]] native_methods::ModulationPtr modulation_ptr() const override {
+    return AUTDModulationCustom(static_cast<native_methods::SamplingConfiguration>(_config), reinterpret_cast<const uint8_t*>(_buffer.data()),
+                                static_cast<uint64_t>(_buffer.size()), static_cast<native_methods::LoopBehavior>(_loop_behavior));
+  }
+
+ private:
+  driver::ModulationBuffer _buffer;
+};
+
+}  // namespace autd3::modulation
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "autd3/driver/common/emit_intensity.hpp"
+#include "autd3/driver/common/loop_behavior.hpp"
+#include "autd3/driver/common/mapped_file.hpp"
+#include "autd3/driver/common/sampling_config.hpp"
+#include "autd3/driver/datagram/modulation/buffer.hpp"
+#include "autd3/exception.hpp"
+#include "autd3/modulation/custom.hpp"
+#include "autd3/native_methods.hpp"
+
+namespace autd3::modulation {
+
+/**
+ * @brief Binary layout of the effect bank
+ * @details All values are stored in the host byte order.
+ * - Header: magic (8 bytes), version (u32), number of effects (u32)
+ * - Index: byte offset (u64), number of samples (u64), sampling frequency division (u32) and loop behavior (u32) for each effect
+ * - Data blocks: intensities of each effect
+ */
+namespace effect_bank {
+constexpr std::string_view MAGIC = "AUTD3MEB";
+constexpr uint32_t VERSION = 1;
+
+struct Header {
+  std::array<char, 8> magic;
+  uint32_t version;
+  uint32_t num_effects;
+};
+
+struct Entry {
+  uint64_t offset;
+  uint64_t size;
+  uint32_t freq_div;
+  uint32_t loop_behavior;
+};
+
+[[nodiscard]] inline uint32_t encode(const driver::LoopBehavior loop_behavior) {
+  return static_cast<native_methods::LoopBehavior>(loop_behavior).rep;
+}
+
+[[nodiscard]] inline driver::LoopBehavior decode(const uint32_t rep) {
+  if (rep == encode(driver::LoopBehavior::infinite())) return driver::LoopBehavior::infinite();
+  return driver::LoopBehavior::finite(rep - encode(driver::LoopBehavior::finite(1)) + 1);
+}
+}  // namespace effect_bank
+
+/**
+ * @brief Writer of the effect bank
+ */
+class EffectBankWriter final {
+ public:
+  EffectBankWriter() = default;
+
+  /**
+   * @brief Calculate the modulation and add its data, sampling configuration and loop behavior to the bank
+   */
+  template <class M>
+  void add(const M& m) & {
+    const auto [buf, config] = driver::calc_modulation(m);
+    _entries.emplace_back(effect_bank::Entry{static_cast<uint64_t>(_data.size()), static_cast<uint64_t>(buf.size()), config.frequency_division(),
+                                             effect_bank::encode(m.loop_behavior())});
+    _data.insert(_data.end(), buf.begin(), buf.end());
+  }
+
+  /**
+   * @brief Calculate the modulation and add its data, sampling configuration and loop behavior to the bank
+   */
+  template <class M>
+  [[nodiscard]] EffectBankWriter&& add(const M& m) && {
+    add(m);
+    return std::move(*this);
+  }
+
+  /**
+   * @brief Write the bank to the file
+   */
+  void write(const std::filesystem::path& path) const {
+    effect_bank::Header header{};
+    std::ranges::copy(effect_bank::MAGIC, header.magic.begin());
+    header.version = effect_bank::VERSION;
+    header.num_effects = static_cast<uint32_t>(_entries.size());
+
+    const auto data_offset = sizeof(effect_bank::Header) + sizeof(effect_bank::Entry) * _entries.size();
+    auto entries = _entries;
+    std::ranges::for_each(entries, [data_offset](effect_bank::Entry& e) { e.offset += data_offset; });
+
+    std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+    if (!ofs) throw AUTDException("Failed to open " + path.string());
+    ofs.write(reinterpret_cast<const char*>(&header), sizeof(effect_bank::Header));
+    ofs.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(sizeof(effect_bank::Entry) * entries.size()));
+    ofs.write(reinterpret_cast<const char*>(_data.data()), static_cast<std::streamsize>(_data.size()));
+    if (!ofs) throw AUTDException("Failed to write " + path.string());
+  }
+
+ private:
+  std::vector<effect_bank::Entry> _entries;
+  std::vector<driver::EmitIntensity> _data;
+};
+
+/**
+ * @brief Effect bank loaded by memory mapping
+ * @details Each effect is a Custom modulation referring to the mapped memory, so neither calculation nor copy is needed to send it.
+ */
+class EffectBank final {
+ public:
+  /**
+   * @brief Open the effect bank
+   *
+   * @param path Path to the bank
+   */
+  [[nodiscard]] static EffectBank open(const std::filesystem::path& path) {
+    auto file = std::make_shared<const driver::MappedFile>(path);
+    const auto bytes = file->bytes();
+
+    effect_bank::Header header{};
+    if (bytes.size() < sizeof(effect_bank::Header)) throw AUTDException("Invalid effect bank");
+    std::memcpy(&header, bytes.data(), sizeof(effect_bank::Header));
+    if (!std::ranges::equal(header.magic, effect_bank::MAGIC)) throw AUTDException("Invalid effect bank");
+    if (header.version != effect_bank::VERSION) throw AUTDException("Unsupported effect bank version");
+
+    const auto index_offset = sizeof(effect_bank::Header);
+    if (bytes.size() < index_offset + sizeof(effect_bank::Entry) * header.num_effects) throw AUTDException("Invalid effect bank");
+    std::vector<effect_bank::Entry> entries(header.num_effects);
+    std::memcpy(entries.data(), bytes.data() + index_offset, sizeof(effect_bank::Entry) * header.num_effects);
+    if (std::ranges::any_of(entries, [&](const effect_bank::Entry& e) { return e.offset > bytes.size() || e.size > bytes.size() - e.offset; }))
+      throw AUTDException("Invalid effect bank");
+
+    return EffectBank(std::move(file), std::move(entries));
+  }
+
+  /**
+   * @brief Get the number of effects
+   */
+  [[nodiscard]] size_t size() const noexcept { return _entries.size(); }
+
+  [[nodiscard]] Custom operator[](const size_t i) const {
+    const auto& e = _entries.at(i);
+    const auto* data = reinterpret_cast<const driver::EmitIntensity*>(_file->data() + e.offset);
+    driver::ModulationBuffer buf(_file, {data, static_cast<size_t>(e.size)});
+    return Custom(std::move(buf), driver::SamplingConfiguration::from_frequency_division(e.freq_div))
+        .with_loop_behavior(effect_bank::decode(e.loop_behavior));
+  }
+
+ private:
+  EffectBank(std::shared_ptr<const driver::MappedFile> file, std::vector<effect_bank::Entry> entries)
+      : _file(std::move(file)), _entries(std::move(entries)) {}
+
+  std::shared_ptr<const driver::MappedFile> _file;
+  std::vector<effect_bank::Entry> _entries;
+};
+
+}  // namespace autd3::modulation
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+
+#include "autd3/def.hpp"
+#include "autd3/driver/common/emit_intensity.hpp"
+#include "autd3/driver/common/sampling_config.hpp"
+#include "autd3/driver/datagram/modulation/buffer.hpp"
+#include "autd3/driver/datagram/modulation/modulation.hpp"
+#include "autd3/native_methods.hpp"
+
+namespace autd3::modulation {
+
+namespace fixed {
+
+/**
+ * @brief Length of the data of `Freq` Hz wave sampled with the frequency division `Div` in SamplingMode::ExactFrequency
+ * @details The data has `N` samples and contains `REP` periods.
+ */
+template <uint32_t Freq, uint32_t Div>
+struct Period {
+  static_assert(Div > 0 && native_methods::FPGA_CLK_FREQ % Div == 0, "Sampling frequency must be integer");
+  static constexpr uint32_t SAMPLING_FREQ = native_methods::FPGA_CLK_FREQ / Div;
+  static_assert(Freq > 0 && Freq <= SAMPLING_FREQ / 2, "Frequency is out of range");
+  static constexpr size_t N = SAMPLING_FREQ / std::gcd(SAMPLING_FREQ, Freq);
+  static constexpr size_t REP = Freq / std::gcd(SAMPLING_FREQ, Freq);
+};
+
+constexpr double sin_taylor(const double x) {
+  double term = x;
+  double sum = x;
+  for (int k = 1; k < 12; k++) {
+    term *= -x * x / static_cast<double>((2 * k) * (2 * k + 1));
+    sum += term;
+  }
+  return sum;
+}
+
+constexpr double cos_taylor(const double x) {
+  double term = 1.0;
+  double sum = 1.0;
+  for (int k = 1; k < 12; k++) {
+    term *= -x * x / static_cast<double>((2 * k - 1) * (2 * k));
+    sum += term;
+  }
+  return sum;
+}
+
+/**
+ * @brief `sin(2π k / n)` at compile time
+ * @details The angle is folded into [0, π/4] with the integers `k` and `n`, so that the zeros and peaks are exact.
+ */
+constexpr double sin_2pi(const uint64_t k, const uint64_t n) {
+  const auto m = 4 * (k % n);
+  const auto quadrant = m / n;
+  const auto r = m % n;
+  const auto s = 2 * r <= n ? sin_taylor(driver::pi / 2.0 * static_cast<double>(r) / static_cast<double>(n))
+                            : cos_taylor(driver::pi / 2.0 * static_cast<double>(n - r) / static_cast<double>(n));
+  const auto c = 2 * r <= n ? cos_taylor(driver::pi / 2.0 * static_cast<double>(r) / static_cast<double>(n))
+                            : sin_taylor(driver::pi / 2.0 * static_cast<double>(n - r) / static_cast<double>(n));
+  switch (quadrant) {
+    case 0:
+      return s;
+    case 1:
+      return c;
+    case 2:
+      return -s;
+    default:
+      return -c;
+  }
+}
+
+/**
+ * @brief Round to the nearest intensity, where halfway cases are rounded away from zero
+ */
+constexpr uint8_t to_intensity(const double v) {
+  if (!(v > 0.0)) return 0;
+  if (v >= 255.0) return 255;
+  const auto t = static_cast<uint32_t>(v);
+  return static_cast<uint8_t>(v - static_cast<double>(t) >= 0.5 ? t + 1 : t);
+}
+
+template <size_t N, size_t... I>
+constexpr std::array<driver::EmitIntensity, N> to_array(const std::array<uint8_t, N>& raw, std::index_sequence<I...>) {
+  return {driver::EmitIntensity(raw[I])...};
+}
+
+/**
+ * @brief Data of Sine with the default parameters
+ */
+template <uint32_t Freq, uint32_t Div>
+constexpr std::array<driver::EmitIntensity, Period<Freq, Div>::N> sine() {
+  using P = Period<Freq, Div>;
+  std::array<uint8_t, P::N> raw{};
+  const auto amp = static_cast<double>(driver::EmitIntensity::maximum().value()) / 2.0;
+  const auto offset = static_cast<double>(driver::EmitIntensity::maximum().value() / 2);
+  for (size_t i = 0; i < P::N; i++) raw[i] = to_intensity(amp * sin_2pi(P::REP * i, P::N) + offset);
+  return to_array(raw, std::make_index_sequence<P::N>());
+}
+
+/**
+ * @brief Data of Square with the default parameters
+ * @details Each of `REP` periods is split into `(N + i) / REP` samples, and the first half of them are high.
+ */
+template <uint32_t Freq, uint32_t Div>
+constexpr std::array<driver::EmitIntensity, Period<Freq, Div>::N> square() {
+  using P = Period<Freq, Div>;
+  std::array<uint8_t, P::N> raw{};
+  size_t idx = 0;
+  for (size_t i = 0; i < P::REP; i++) {
+    const auto size = (P::N + i) / P::REP;
+    const auto n_high = static_cast<size_t>(static_cast<double>(size) * 0.5);
+    for (size_t j = 0; j < size; j++) raw[idx++] = j < n_high ? driver::EmitIntensity::maximum().value() : driver::EmitIntensity::minimum().value();
+  }
+  return to_array(raw, std::make_index_sequence<P::N>());
+}
+
+template <uint32_t Freq, uint32_t Div>
+struct SineTable {
+  static constexpr uint32_t DIV = Div;
+  static constexpr auto TABLE = sine<Freq, Div>();
+};
+
+template <uint32_t Freq, uint32_t Div>
+struct SquareTable {
+  static constexpr uint32_t DIV = Div;
+  static constexpr auto TABLE = square<Freq, Div>();
+};
+
+}  // namespace fixed
+
+/**
+ * @brief Modulation to send the data generated at compile time
+ * @details The data is a static table, so that neither calculation nor allocation is needed at runtime.
+ */
+template <class Table>
+class Fixed final : public driver::Modulation<Fixed<Table>> {
+ public:
+  static constexpr const auto& TABLE = Table::TABLE;
+
+  Fixed() : driver::Modulation<Fixed>(driver::SamplingConfiguration::from_frequency_division(Table::DIV)) {}
+
+  [[nodiscard]] driver::ModulationBuffer buffer() const { return driver::ModulationBuffer(nullptr, TABLE); }
+
+  [[nodiscard]] size_t size() const override { return TABLE.size(); }
+
+  [[nodiscard]] native_methods::ModulationPtr modulation_ptr() const override {
+    return AUTDModulationCustom(static_cast<native_methods::SamplingConfiguration>(this->_config), reinterpret_cast<const uint8_t*>(TABLE.data()),
+                                static_cast<uint64_t>(TABLE.size()), static_cast<native_methods::LoopBehavior>(this->_loop_behavior));
+  }
+
+ private:
+  using driver::Modulation<Fixed>::with_sampling_config;
+};
+
+/**
+ * @brief Sine with the default parameters, whose data is generated at compile time
+ * @details The data is the same as that of `Sine(Freq).with_sampling_config(SamplingConfiguration::from_frequency_division(Div))`.
+ *
+ * @tparam Freq Frequency of sine wave
+ * @tparam Div Sampling frequency division. The default value corresponds to 4kHz.
+ */
+template <uint32_t Freq, uint32_t Div = 5120>
+using FixedSine = Fixed<fixed::SineTable<Freq, Div>>;
+
+/**
+ * @brief Square with the default parameters, whose data is generated at compile time
+ * @details The data is the same as that of `Square(Freq).with_sampling_config(SamplingConfiguration::from_frequency_division(Div))`.
+ *
+ * @tparam Freq Frequency of square wave
+ * @tparam Div Sampling frequency division. The default value corresponds to 4kHz.
+ */
+template <uint32_t Freq, uint32_t Div = 5120>
+using FixedSquare = Fixed<fixed::SquareTable<Freq, Div>>;
+
+}  // namespace autd3::modulation
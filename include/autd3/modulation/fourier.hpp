@@ -1,8 +1,13 @@
 #pragma once
 
+#include <algorithm>
 #include <numeric>
+#include <optional>
+#include <vector>
 
+#include "autd3/driver/datagram/modulation/buffer.hpp"
 #include "autd3/driver/datagram/modulation/modulation.hpp"
+#include "autd3/exception.hpp"
 #include "autd3/modulation/sine.hpp"
 #include "autd3/native_methods.hpp"
 
@@ -13,18 +18,25 @@ concept fourier_sine_range = std::ranges::viewable_range<R> && std::same_as<std:
 
 /**
  * @brief Multi-frequency sine wave modulation
+ * @details The waveform is synthesized on the C++ side from one period of each component, so the number of components is not limited.
  */
 class Fourier final : public driver::ModulationBase<Fourier>,
+                      public driver::IntoModulationAutoSampling<Fourier>,
                       public driver::IntoModulationCache<Fourier>,
+                      public driver::IntoModulationCompact<Fourier>,
                       public driver::IntoRadiationPressure<Fourier>,
                       public driver::IntoModulationTransform<Fourier> {
  public:
   explicit Fourier(Sine component) : ModulationBase() { _components.emplace_back(std::move(component)); }
 
-  void add_component(Sine component) & { _components.emplace_back(std::move(component)); }
+  void add_component(Sine component) & {
+    _components.emplace_back(std::move(component));
+    invalidate();
+  }
 
   [[nodiscard]] Fourier&& add_component(Sine component) && {
     _components.emplace_back(std::move(component));
+    invalidate();
     return std::move(*this);
   }
 
@@ -37,6 +49,7 @@ class Fourier final : public driver::ModulationBase<Fourier>,
   template <fourier_sine_range R>
   void add_components_from_iter(R&& iter) & {
     for (Sine e : iter) _components.emplace_back(std::move(e));
+    invalidate();
   }
 
   /**
@@ -48,16 +61,19 @@ class Fourier final : public driver::ModulationBase<Fourier>,
   template <fourier_sine_range R>
   [[nodiscard]] Fourier add_components_from_iter(R&& iter) && {
     for (Sine e : iter) _components.emplace_back(std::move(e));
+    invalidate();
     return std::move(*this);
   }
 
   [[nodiscard]] Fourier& operator+=(const Sine& rhs) {
     _components.emplace_back(rhs);
+    invalidate();
     return *this;
   }
 
   [[nodiscard]] friend Fourier&& operator+(Fourier&& lhs, const Sine& rhs) {
     lhs._components.emplace_back(rhs);
+    lhs.invalidate();
     return std::move(lhs);
   }
 
@@ -67,16 +83,57 @@ class Fourier final : public driver::ModulationBase<Fourier>,
     return m;
   }  // LCOV_EXCL_LINE
 
+  [[nodiscard]] driver::SamplingConfiguration sampling_config() const override { return _components.front().sampling_config(); }
+
+  [[nodiscard]] size_t size() const override { return buffer().size(); }
+
+  /**
+   * @brief Get the synthesized modulation data
+   * @details The data is synthesized on the C++ side and memoized until a component is added.
+   */
+  [[nodiscard]] const driver::ModulationBuffer& buffer() const {
+    if (!_buffer.has_value()) _buffer = synthesize(_components);
+    return _buffer.value();
+  }
+
   [[nodiscard]] native_methods::ModulationPtr modulation_ptr() const override {
-    std::vector<native_methods::ModulationPtr> components;
-    components.reserve(_components.size());
-    std::ranges::transform(_components, std::back_inserter(components), [&](const auto& m) { return m.modulation_ptr(); });
-    return AUTDModulationFourier(components.data(), static_cast<uint32_t>(components.size()),
-                                 static_cast<native_methods::LoopBehavior>(_loop_behavior));
+    const auto& buf = buffer();
+    return AUTDModulationCustom(static_cast<native_methods::SamplingConfiguration>(sampling_config()), reinterpret_cast<const uint8_t*>(buf.data()),
+                                static_cast<uint64_t>(buf.size()), static_cast<native_methods::LoopBehavior>(_loop_behavior));
   }
 
  private:
+  /**
+   * @brief Sum one period of each component over the least common multiple of their lengths
+   */
+  [[nodiscard]] static driver::ModulationBuffer synthesize(const std::vector<Sine>& components) {
+    const auto config = components.front().sampling_config();
+    if (std::ranges::any_of(components, [&config](const Sine& c) { return c.sampling_config() != config; }))
+      throw AUTDException("All components must have the same sampling configuration");
+
+    std::vector<std::vector<driver::EmitIntensity>> periods;
+    periods.reserve(components.size());
+    std::ranges::transform(components, std::back_inserter(periods), [](const Sine& c) { return c.calc(); });
+    const auto len =
+        std::accumulate(periods.begin(), periods.end(), size_t{1}, [](const size_t acc, const auto& p) { return std::lcm(acc, p.size()); });
+
+    std::vector<uint32_t> sum(len, 0);
+    for (const auto& p : periods) {
+      const auto n = p.size();
+      for (size_t base = 0; base < len; base += n)
+        for (size_t i = 0; i < n; i++) sum[base + i] += p[i].value();
+    }
+    const auto num = static_cast<uint32_t>(periods.size());
+    std::vector<driver::EmitIntensity> data;
+    data.reserve(len);
+    std::ranges::transform(sum, std::back_inserter(data), [num](const uint32_t v) { return driver::EmitIntensity(static_cast<uint8_t>(v / num)); });
+    return driver::ModulationBuffer(std::move(data));
+  }
+
+  void invalidate() { _buffer.reset(); }
+
   std::vector<Sine> _components;
+  mutable std::optional<driver::ModulationBuffer> _buffer;
 };
 
 }  // namespace autd3::modulation
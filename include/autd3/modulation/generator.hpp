@@ -0,0 +1,96 @@
+#pragma once
+
+#ifdef AUTD3_ASYNC_API
+
+#include <algorithm>
+#include <coro/coro.hpp>
+#include <memory>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "autd3/driver/common/emit_intensity.hpp"
+#include "autd3/driver/common/sampling_config.hpp"
+#include "autd3/driver/datagram/modulation/buffer.hpp"
+#include "autd3/exception.hpp"
+#include "autd3/modulation/stream.hpp"
+
+namespace autd3::modulation {
+
+/**
+ * @brief Source of modulation data yielded lazily by a coroutine
+ * @details The samples are pulled from the generator only when they are read, so the whole waveform is never allocated. Use read to fill a
+ * reusable buffer, or pass this object to autd3::modulation::stream to play the samples chunk by chunk.
+ */
+class Generator final {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param gen Generator yielding the samples, which may be infinite
+   * @param chunk_size Number of samples of each chunk, which must be at least 2 and not exceed the modulation buffer size of the device
+   * @param config Sampling configuration of the samples
+   */
+  Generator(coro::generator<driver::EmitIntensity> gen, const size_t chunk_size,
+            const driver::SamplingConfiguration config = driver::SamplingConfiguration::from_frequency(4e3))
+      : _gen(std::move(gen)), _chunk_size(chunk_size), _config(config) {
+    if (chunk_size < 2) throw AUTDException("Chunk size must be at least 2");
+  }
+  Generator() = delete;                                 // LCOV_EXCL_LINE
+  Generator(const Generator& obj) = delete;             // LCOV_EXCL_LINE
+  Generator& operator=(const Generator& obj) = delete;  // LCOV_EXCL_LINE
+  Generator(Generator&& obj) = default;                 // LCOV_EXCL_LINE
+  Generator& operator=(Generator&& obj) = default;      // LCOV_EXCL_LINE
+  ~Generator() = default;                               // LCOV_EXCL_LINE
+
+  [[nodiscard]] driver::SamplingConfiguration sampling_config() const noexcept { return _config; }
+  [[nodiscard]] size_t chunk_size() const noexcept { return _chunk_size; }
+
+  /**
+   * @brief Check if the generator has finished
+   */
+  [[nodiscard]] bool done() {
+    if (!_it.has_value()) _it = _gen.begin();
+    return _it.value() == _gen.end();
+  }
+
+  /**
+   * @brief Pull the samples from the generator into the buffer
+   *
+   * @param dst Destination
+   * @return Number of samples read, which is less than the size of the destination only when the generator has finished
+   */
+  size_t read(const std::span<driver::EmitIntensity> dst) {
+    size_t n = 0;
+    for (; n < dst.size() && !done(); ++_it.value()) dst[n++] = *_it.value();
+    return n;
+  }
+
+  /**
+   * @brief Get the next chunk
+   * @details The last chunk may be shorter than the chunk size, and it is padded by holding the last sample if it has only one sample. The chunk
+   * is written into a buffer owned by this object, which is reused once all the chunks returned before have been destroyed.
+   *
+   * @return Next chunk, or std::nullopt if the generator has finished
+   */
+  [[nodiscard]] std::optional<driver::ModulationBuffer> next() {
+    if (_buffer.use_count() != 1) _buffer = std::make_shared<std::vector<driver::EmitIntensity>>(_chunk_size, driver::EmitIntensity::minimum());
+    auto& chunk = *_buffer;
+    const auto n = read(chunk);
+    if (n == 0) return std::nullopt;
+    if (n == 1) chunk[1] = chunk[0];
+    return driver::ModulationBuffer(_buffer, std::span<const driver::EmitIntensity>(chunk.data(), std::max<size_t>(n, 2)));
+  }
+
+ private:
+  coro::generator<driver::EmitIntensity> _gen;
+  std::optional<coro::generator<driver::EmitIntensity>::iterator> _it{std::nullopt};
+  size_t _chunk_size;
+  driver::SamplingConfiguration _config;
+  std::shared_ptr<std::vector<driver::EmitIntensity>> _buffer{nullptr};
+};
+
+}  // namespace autd3::modulation
+
+#endif
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "autd3/driver/common/emit_intensity.hpp"
+#include "autd3/driver/common/sampling_config.hpp"
+#include "autd3/driver/common/spsc_ring_buffer.hpp"
+#include "autd3/driver/datagram/modulation/buffer.hpp"
+#include "autd3/exception.hpp"
+#include "autd3/modulation/stream.hpp"
+
+namespace autd3::modulation {
+
+/**
+ * @brief Source of modulation data fed from a live signal
+ * @details A producer thread pushes samples into a lock-free ring buffer, and autd3::modulation::stream on another thread pops them chunk by
+ * chunk. If the producer is late, the chunk is filled by holding the last sample (underrun). If the ring buffer is full, the samples which cannot
+ * be pushed are dropped (overrun). The latency is bounded by the capacity of the ring buffer plus two chunks.
+ */
+class LiveModulation final {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param capacity Capacity of the ring buffer in samples, which is rounded up to a power of two
+   * @param chunk_size Number of samples of each chunk, which must be at least 2 and not exceed the modulation buffer size of the device
+   * @param config Sampling configuration of the chunks
+   */
+  LiveModulation(const size_t capacity, const size_t chunk_size,
+                 const driver::SamplingConfiguration config = driver::SamplingConfiguration::from_frequency(4e3))
+      : _ring(capacity), _chunk_size(chunk_size), _config(config), _last(driver::EmitIntensity::minimum()) {
+    if (chunk_size < 2) throw AUTDException("Chunk size must be at least 2");
+  }
+
+  [[nodiscard]] driver::SamplingConfiguration sampling_config() const noexcept { return _config; }
+  [[nodiscard]] size_t chunk_size() const noexcept { return _chunk_size; }
+  [[nodiscard]] size_t capacity() const noexcept { return _ring.capacity(); }
+
+  /**
+   * @brief Push samples from the producer thread
+   *
+   * @return Number of samples pushed, which is less than requested if the ring buffer is full
+   */
+  size_t push(const std::span<const driver::EmitIntensity> data) {
+    const auto n = _ring.push(std::span(reinterpret_cast<const uint8_t*>(data.data()), data.size()));
+    if (n < data.size()) _overruns.fetch_add(data.size() - n, std::memory_order_relaxed);
+    return n;
+  }
+
+  /**
+   * @brief Notify that the producer has finished
+   * @details The stream ends after the samples already pushed have been played.
+   */
+  void close() noexcept { _closed.store(true, std::memory_order_release); }
+
+  /**
+   * @brief Get the next chunk on the consumer thread
+   *
+   * @return Next chunk, or std::nullopt if the producer has finished and all samples have been popped
+   */
+  [[nodiscard]] std::optional<driver::ModulationBuffer> next() {
+    const auto closed = _closed.load(std::memory_order_acquire);
+    std::vector chunk(_chunk_size, _last);
+    const auto n = _ring.pop(std::span(reinterpret_cast<uint8_t*>(chunk.data()), chunk.size()));
+    if (n == 0 && closed) return std::nullopt;
+    if (n > 0) {
+      _last = chunk[n - 1];
+      std::fill(chunk.begin() + static_cast<std::ptrdiff_t>(n), chunk.end(), _last);
+    }
+    if (closed)
+      chunk.resize(std::max<size_t>(n, 2), _last);
+    else if (n < _chunk_size)
+      _underruns.fetch_add(_chunk_size - n, std::memory_order_relaxed);
+    return driver::ModulationBuffer(std::move(chunk));
+  }
+
+  /**
+   * @brief Get the number of samples filled because the producer was late
+   */
+  [[nodiscard]] uint64_t underruns() const noexcept { return _underruns.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Get the number of samples dropped because the ring buffer was full
+   */
+  [[nodiscard]] uint64_t overruns() const noexcept { return _overruns.load(std::memory_order_relaxed); }
+
+ private:
+  driver::SpscRingBuffer<uint8_t> _ring;
+  size_t _chunk_size;
+  driver::SamplingConfiguration _config;
+  driver::EmitIntensity _last;
+  std::atomic<bool> _closed{false};
+  std::atomic<uint64_t> _underruns{0};
+  std::atomic<uint64_t> _overruns{0};
+};
+
+}  // namespace autd3::modulation
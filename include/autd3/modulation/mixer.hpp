@@ -0,0 +1,188 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "autd3/driver/common/emit_intensity.hpp"
+#include "autd3/driver/common/sampling_config.hpp"
+#include "autd3/driver/datagram/modulation/buffer.hpp"
+#include "autd3/driver/datagram/modulation/modulation.hpp"
+#include "autd3/exception.hpp"
+#include "autd3/modulation/resampler.hpp"
+#include "autd3/native_methods.hpp"
+
+namespace autd3::modulation {
+
+/**
+ * @brief Modulation to combine the results of other modulations
+ * @details Each input is calculated once and resampled to the sampling configuration of the mixer, which is the finest one of the inputs by
+ * default. For sum and product, the inputs are repeated over the least common multiple of their lengths. The result is memoized and shared among
+ * the copies of this object.
+ */
+class Mixer final : public driver::Modulation<Mixer> {
+  using input_t = std::function<std::pair<driver::ModulationBuffer, driver::SamplingConfiguration>()>;
+  using cache_t = std::optional<std::pair<driver::ModulationBuffer, driver::SamplingConfiguration>>;
+
+ public:
+  enum class Op : uint8_t {
+    Sum,
+    Product,
+    Crossfade,
+  };
+
+  Mixer() = delete;                              // LCOV_EXCL_LINE
+  Mixer(const Mixer& obj) = default;             // LCOV_EXCL_LINE
+  Mixer& operator=(const Mixer& obj) = default;  // LCOV_EXCL_LINE
+  Mixer(Mixer&& obj) = default;                  // LCOV_EXCL_LINE
+  Mixer& operator=(Mixer&& obj) = default;       // LCOV_EXCL_LINE
+  ~Mixer() override = default;                   // LCOV_EXCL_LINE
+
+  /**
+   * @brief Saturating sum of the inputs
+   */
+  template <class... Ms>
+    requires(sizeof...(Ms) >= 2)
+  [[nodiscard]] static Mixer sum(Ms... ms) {
+    return Mixer(Op::Sum, 0, std::move(ms)...);
+  }
+
+  /**
+   * @brief Product of the inputs, where the maximum intensity is regarded as 1
+   */
+  template <class... Ms>
+    requires(sizeof...(Ms) >= 2)
+  [[nodiscard]] static Mixer product(Ms... ms) {
+    return Mixer(Op::Product, 0, std::move(ms)...);
+  }
+
+  /**
+   * @brief Play a and then b, where the end of a is linearly crossfaded into the beginning of b
+   *
+   * @param a First modulation
+   * @param b Second modulation
+   * @param fade Number of samples to overlap in the sampling configuration of the mixer
+   */
+  template <class A, class B>
+  [[nodiscard]] static Mixer crossfade(A a, B b, const size_t fade) {
+    return Mixer(Op::Crossfade, fade, std::move(a), std::move(b));
+  }
+
+  [[nodiscard]] Op op() const noexcept { return _op; }
+
+  /**
+   * @brief Get the mixed modulation data
+   */
+  [[nodiscard]] const driver::ModulationBuffer& buffer() const {
+    if (!_cache->has_value() || _cache->value().second != _config) *_cache = std::make_pair(mix(), _config);
+    return _cache->value().first;
+  }
+
+  [[nodiscard]] size_t size() const override { return buffer().size(); }
+
+  [[nodiscard]] native_methods::ModulationPtr modulation_ptr() const override {
+    const auto& buf = buffer();
+    return AUTDModulationCustom(static_cast<native_methods::SamplingConfiguration>(_config), reinterpret_cast<const uint8_t*>(buf.data()),
+                                static_cast<uint64_t>(buf.size()), static_cast<native_methods::LoopBehavior>(_loop_behavior));
+  }
+
+ private:
+  template <class... Ms>
+  Mixer(const Op op, const size_t fade, Ms... ms)
+      : Modulation(std::min({ms.sampling_config()...})), _op(op), _fade(fade), _cache(std::make_shared<cache_t>()) {
+    _inputs.reserve(sizeof...(Ms));
+    (_inputs.emplace_back([m = std::move(ms)] { return driver::calc_modulation(m); }), ...);
+  }
+
+  [[nodiscard]] driver::ModulationBuffer mix() const {
+    std::vector<std::vector<uint8_t>> inputs;
+    inputs.reserve(_inputs.size());
+    std::ranges::transform(_inputs, std::back_inserter(inputs), [this](const input_t& input) {
+      const auto [buf, config] = input();
+      return resample(buf, config, _config);
+    });
+    if (std::ranges::any_of(inputs, [](const auto& v) { return v.empty(); })) throw AUTDException("Modulation data must not be empty");
+
+    std::vector<driver::EmitIntensity> data;
+    if (_op == Op::Crossfade) {
+      const auto& a = inputs[0];
+      const auto& b = inputs[1];
+      if (_fade > a.size() || _fade > b.size()) throw AUTDException("Crossfade length exceeds the modulation data");
+      data.resize(a.size() + b.size() - _fade, driver::EmitIntensity(0));
+      auto* dst = reinterpret_cast<uint8_t*>(data.data());
+      const auto head = a.size() - _fade;
+      std::memcpy(dst, a.data(), head);
+      blend(dst + head, a.data() + head, b.data(), _fade);
+      std::memcpy(dst + a.size(), b.data() + _fade, b.size() - _fade);
+      return driver::ModulationBuffer(std::move(data));
+    }
+
+    const auto len =
+        std::accumulate(inputs.begin(), inputs.end(), size_t{1}, [](const size_t acc, const auto& v) { return std::lcm(acc, v.size()); });
+    data.resize(len, driver::EmitIntensity(0));
+    auto* dst = reinterpret_cast<uint8_t*>(data.data());
+    tile(dst, inputs[0], len);
+    std::vector<uint8_t> tiled(len);
+    for (size_t k = 1; k < inputs.size(); k++) {
+      tile(tiled.data(), inputs[k], len);
+      if (_op == Op::Sum)
+        add_saturate(dst, tiled.data(), len);
+      else
+        multiply(dst, tiled.data(), len);
+    }
+    return driver::ModulationBuffer(std::move(data));
+  }
+
+  [[nodiscard]] static std::vector<uint8_t> resample(const driver::ModulationBuffer& buf, const driver::SamplingConfiguration from,
+                                                     const driver::SamplingConfiguration to) {
+    std::vector<uint8_t> out(buf.size());
+    std::ranges::transform(buf, out.begin(), [](const driver::EmitIntensity v) { return v.value(); });
+    if (from == to) return out;
+    // the ratio of the sampling rates is the inverse of the ratio of the frequency divisions
+    PolyphaseResampler resampler(to.frequency_division(), from.frequency_division());
+    std::vector<double> in(out.begin(), out.end());
+    const auto resampled = resampler.resample(in);
+    out.resize(resampled.size());
+    std::ranges::transform(resampled, out.begin(), [](const double v) { return static_cast<uint8_t>(std::clamp(std::round(v), 0.0, 255.0)); });
+    return out;
+  }
+
+  // The kernels below operate on contiguous arrays without branches so that the compiler can vectorize them.
+
+  static void tile(uint8_t* dst, const std::vector<uint8_t>& src, const size_t len) {
+    for (size_t base = 0; base < len; base += src.size()) std::memcpy(dst + base, src.data(), src.size());
+  }
+
+  static void add_saturate(uint8_t* dst, const uint8_t* src, const size_t len) noexcept {
+    for (size_t i = 0; i < len; i++) dst[i] = static_cast<uint8_t>(std::min<uint16_t>(static_cast<uint16_t>(dst[i] + src[i]), 255));
+  }
+
+  static void multiply(uint8_t* dst, const uint8_t* src, const size_t len) noexcept {
+    for (size_t i = 0; i < len; i++) {
+      // round(x / 255) for x in [0, 255 * 255]
+      const auto t = static_cast<uint16_t>(dst[i] * src[i] + 128);
+      dst[i] = static_cast<uint8_t>((t + (t >> 8)) >> 8);
+    }
+  }
+
+  static void blend(uint8_t* dst, const uint8_t* a, const uint8_t* b, const size_t len) noexcept {
+    for (size_t i = 0; i < len; i++) {
+      const auto w = static_cast<uint32_t>((i + 1) * 256 / (len + 1));
+      dst[i] = static_cast<uint8_t>((a[i] * (256 - w) + b[i] * w + 128) >> 8);
+    }
+  }
+
+  Op _op;
+  size_t _fade;
+  std::vector<input_t> _inputs;
+  std::shared_ptr<cache_t> _cache;
+};
+
+}  // namespace autd3::modulation
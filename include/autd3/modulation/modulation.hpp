@@ -1,6 +1,12 @@
 #pragma once
 
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
 #include "autd3/driver/common/emit_intensity.hpp"
+#include "autd3/driver/common/sampling_config.hpp"
 #include "autd3/driver/datagram/modulation/modulation.hpp"
 #include "autd3/native_methods.hpp"
 
@@ -8,6 +14,7 @@ namespace autd3::modulation {
 
 /**
  * @brief Base class for custom modulation
+ * @details calc is called for every send. The number of data is memoized until the sampling configuration changes, and is updated by every send.
  */
 template <class M>
 class Modulation : public driver::Modulation<M> {
@@ -16,12 +23,64 @@ class Modulation : public driver::Modulation<M> {
 
   [[nodiscard]] virtual std::vector<driver::EmitIntensity> calc() const = 0;
 
+  [[nodiscard]] size_t size() const override {
+    if (!_size.has_value() || _size->first != this->_config) _size = std::make_pair(this->_config, calc().size());
+    return _size->second;
+  }
+
   [[nodiscard]] native_methods::ModulationPtr modulation_ptr() const override {
     const auto buffer = calc();
     const auto size = buffer.size();
+    _size = std::make_pair(this->_config, size);
     return AUTDModulationCustom(static_cast<native_methods::SamplingConfiguration>(this->_config), reinterpret_cast<const uint8_t*>(buffer.data()),
                                 size, static_cast<native_methods::LoopBehavior>(this->_loop_behavior));
   }
+
+ private:
+  mutable std::optional<std::pair<driver::SamplingConfiguration, size_t>> _size;
+};
+
+/**
+ * @brief Base class for custom modulation which writes its data into the given buffer
+ * @details The data is written into a buffer owned by this object, which is reused for every send without allocation.
+ */
+template <class M>
+class ModulationInto : public driver::Modulation<M> {
+ public:
+  using driver::Modulation<M>::Modulation;
+
+  /**
+   * @brief Get the number of modulation data
+   */
+  [[nodiscard]] virtual size_t required_size() const = 0;
+
+  /**
+   * @brief Write the modulation data
+   *
+   * @param dst Buffer whose size is required_size()
+   */
+  virtual void calc_into(std::span<driver::EmitIntensity> dst) const = 0;
+
+  /**
+   * @brief Get the modulation data in a new vector
+   */
+  [[nodiscard]] std::vector<driver::EmitIntensity> calc() const {
+    std::vector buffer(required_size(), driver::EmitIntensity::minimum());
+    calc_into(buffer);
+    return buffer;
+  }
+
+  [[nodiscard]] size_t size() const override { return required_size(); }
+
+  [[nodiscard]] native_methods::ModulationPtr modulation_ptr() const override {
+    _buffer.resize(required_size(), driver::EmitIntensity::minimum());
+    calc_into(_buffer);
+    return AUTDModulationCustom(static_cast<native_methods::SamplingConfiguration>(this->_config), reinterpret_cast<const uint8_t*>(_buffer.data()),
+                                _buffer.size(), static_cast<native_methods::LoopBehavior>(this->_loop_behavior));
+  }
+
+ private:
+  mutable std::vector<driver::EmitIntensity> _buffer;
 };
 
 }  // namespace autd3::modulation
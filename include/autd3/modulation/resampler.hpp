@@ -0,0 +1,239 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <span>
+#include <tuple>
+#include <vector>
+
+#include "autd3/def.hpp"
+#include "autd3/driver/common/sampling_config.hpp"
+#include "autd3/exception.hpp"
+#include "autd3/native_methods.hpp"
+
+namespace autd3::modulation {
+
+/**
+ * @brief Streaming polyphase resampler with windowed-sinc filter
+ * @details The ratio of the sampling rates is reduced to L/M, and each output sample is the dot product of the input around it with one of L
+ * precomputed filter phases. If L exceeds MAX_PHASES, the nearest of MAX_PHASES phases is used. The coefficient tables are shared among the
+ * resamplers with the same rates and filter length. The input is extended by repeating its first and last samples.
+ */
+class PolyphaseResampler final {
+ public:
+  static constexpr size_t MAX_PHASES = 1024;
+  static constexpr size_t DEFAULT_HALF_TAPS = 16;
+
+  /**
+   * @brief Constructor
+   *
+   * @param in_rate Sampling rate of the input
+   * @param out_rate_num Numerator of the sampling rate of the output
+   * @param out_rate_den Denominator of the sampling rate of the output
+   * @param half_taps Number of filter taps on each side of an output sample, which is scaled by the ratio when down-sampling
+   */
+  PolyphaseResampler(const uint64_t in_rate, const uint64_t out_rate_num, const uint64_t out_rate_den = 1,
+                     const size_t half_taps = DEFAULT_HALF_TAPS) {
+    if (in_rate == 0 || out_rate_num == 0 || out_rate_den == 0) throw AUTDException("Sampling rate must be positive");
+    if (half_taps == 0) throw AUTDException("Number of taps must be positive");
+    // out / in = out_rate_num / (out_rate_den * in_rate) = L / M
+    const auto g = std::gcd(out_rate_num, out_rate_den * in_rate);
+    _l = out_rate_num / g;
+    _m = out_rate_den * in_rate / g;
+    _table = table(_l, _m, half_taps);
+  }
+
+  /**
+   * @brief Constructor to resample to the sampling frequency of modulation
+   *
+   * @param in_rate Sampling rate of the input
+   * @param config Sampling configuration of the output
+   * @param half_taps Number of filter taps on each side of an output sample, which is scaled by the ratio when down-sampling
+   */
+  PolyphaseResampler(const uint64_t in_rate, const driver::SamplingConfiguration config, const size_t half_taps = DEFAULT_HALF_TAPS)
+      : PolyphaseResampler(in_rate, native_methods::FPGA_CLK_FREQ, config.frequency_division(), half_taps) {}
+
+  /**
+   * @brief Up-sampling factor L of the reduced ratio L/M
+   */
+  [[nodiscard]] uint64_t up() const noexcept { return _l; }
+  /**
+   * @brief Down-sampling factor M of the reduced ratio L/M
+   */
+  [[nodiscard]] uint64_t down() const noexcept { return _m; }
+  /**
+   * @brief Number of filter taps per output sample
+   */
+  [[nodiscard]] size_t taps() const noexcept { return _table->taps; }
+
+  /**
+   * @brief Resample the next chunk of the input and append the result to the output
+   */
+  void process(const std::span<const double> in, std::vector<double>& out) {
+    if (in.empty()) return;
+    if (_in_count == 0) _first = in.front();
+    _buf.insert(_buf.end(), in.begin(), in.end());
+    _in_count += in.size();
+    const auto half = static_cast<int64_t>(_table->taps / 2);
+    for (;;) {
+      const auto [i, q] = position();
+      if (i + half >= static_cast<int64_t>(_in_count)) break;
+      out.emplace_back(output(i, q, false));
+      advance();
+    }
+    const auto keep_from = std::max<int64_t>(position().first - half, 0);
+    if (const auto drop = std::min<int64_t>(keep_from - static_cast<int64_t>(_buf_start), static_cast<int64_t>(_buf.size())); drop > 0) {
+      _buf.erase(_buf.begin(), _buf.begin() + drop);
+      _buf_start += static_cast<uint64_t>(drop);
+    }
+  }
+
+  /**
+   * @brief Output the samples remaining at the end of the input
+   */
+  void flush(std::vector<double>& out) {
+    if (_in_count == 0) return;
+    for (;;) {
+      // the output samples are those before the end of the input
+      if (_i >= _in_count) break;
+      const auto [i, q] = position();
+      out.emplace_back(output(i, q, true));
+      advance();
+    }
+  }
+
+  /**
+   * @brief Reset the state to resample a new input
+   */
+  void reset() noexcept {
+    _buf.clear();
+    _buf_start = 0;
+    _in_count = 0;
+    _first = 0.0;
+    _i = 0;
+    _p = 0;
+  }
+
+  /**
+   * @brief Resample the whole input
+   */
+  [[nodiscard]] std::vector<double> resample(const std::span<const double> in) {
+    reset();
+    std::vector<double> out;
+    out.reserve(static_cast<size_t>((in.size() * _l + _m - 1) / _m));
+    process(in, out);
+    flush(out);
+    reset();
+    return out;
+  }
+
+ private:
+  struct Table {
+    size_t phases;
+    size_t taps;
+    std::vector<double> coef;
+  };
+
+  [[nodiscard]] static std::shared_ptr<const Table> table(const uint64_t l, const uint64_t m, const size_t half_taps) {
+    static std::mutex mtx;
+    static std::map<std::tuple<uint64_t, uint64_t, size_t>, std::shared_ptr<const Table>> cache;
+    std::lock_guard lock(mtx);
+    auto& t = cache[{l, m, half_taps}];
+    if (t == nullptr) t = make_table(l, m, half_taps);
+    return t;
+  }
+
+  [[nodiscard]] static std::shared_ptr<const Table> make_table(const uint64_t l, const uint64_t m, const size_t half_taps) {
+    const auto fc = std::min(1.0, static_cast<double>(l) / static_cast<double>(m));
+    const auto half = static_cast<size_t>(std::ceil(static_cast<double>(half_taps) / fc));
+    auto t = std::make_shared<Table>();
+    t->phases = static_cast<size_t>(std::min<uint64_t>(l, MAX_PHASES));
+    t->taps = 2 * half;
+    t->coef.resize(t->phases * t->taps);
+    const auto width = static_cast<double>(half);
+    for (size_t q = 0; q < t->phases; q++) {
+      const auto frac = static_cast<double>(q) / static_cast<double>(t->phases);
+      auto* h = t->coef.data() + q * t->taps;
+      if (q == 0 && l >= m) {
+        // the output sample coincides with an input sample
+        std::fill(h, h + t->taps, 0.0);
+        h[half - 1] = 1.0;
+        continue;
+      }
+      for (size_t k = 0; k < t->taps; k++) {
+        const auto x = static_cast<double>(k) - static_cast<double>(half - 1) - frac;
+        const auto sinc = x == 0.0 ? 1.0 : std::sin(driver::pi * fc * x) / (driver::pi * fc * x);
+        const auto window =
+            std::abs(x) >= width ? 0.0 : 0.42 + 0.5 * std::cos(driver::pi * x / width) + 0.08 * std::cos(2.0 * driver::pi * x / width);
+        h[k] = sinc * window;
+      }
+      const auto sum = std::accumulate(h, h + t->taps, 0.0);
+      std::transform(h, h + t->taps, h, [sum](const double v) { return v / sum; });
+    }
+    return t;
+  }
+
+  [[nodiscard]] std::pair<int64_t, size_t> position() const noexcept {
+    if (_l <= MAX_PHASES) return {static_cast<int64_t>(_i), static_cast<size_t>(_p)};
+    const auto q = (_p * MAX_PHASES + _l / 2) / _l;
+    if (q == MAX_PHASES) return {static_cast<int64_t>(_i) + 1, 0};
+    return {static_cast<int64_t>(_i), static_cast<size_t>(q)};
+  }
+
+  void advance() noexcept {
+    _p += _m;
+    _i += _p / _l;
+    _p %= _l;
+  }
+
+  [[nodiscard]] double output(const int64_t i, const size_t q, const bool at_end) {
+    const auto taps = _table->taps;
+    const auto* h = _table->coef.data() + q * taps;
+    const auto begin = i - static_cast<int64_t>(taps / 2) + 1;
+    const double* x;
+    if (begin >= static_cast<int64_t>(_buf_start) && (!at_end || begin + static_cast<int64_t>(taps) <= static_cast<int64_t>(_in_count))) {
+      x = _buf.data() + (begin - static_cast<int64_t>(_buf_start));
+    } else {
+      _window.resize(taps);
+      for (size_t k = 0; k < taps; k++) {
+        const auto j = begin + static_cast<int64_t>(k);
+        if (j < 0)
+          _window[k] = _first;
+        else if (j >= static_cast<int64_t>(_in_count))
+          _window[k] = _buf.back();
+        else
+          _window[k] = _buf[static_cast<size_t>(j - static_cast<int64_t>(_buf_start))];
+      }
+      x = _window.data();
+    }
+    return dot(h, x, taps);
+  }
+
+  [[nodiscard]] static double dot(const double* h, const double* x, const size_t n) noexcept {
+    // independent accumulators allow the compiler to vectorize the reduction without reassociating floating point operations
+    double acc[4] = {0.0, 0.0, 0.0, 0.0};
+    size_t k = 0;
+    for (; k + 4 <= n; k += 4)
+      for (size_t j = 0; j < 4; j++) acc[j] += h[k + j] * x[k + j];
+    for (; k < n; k++) acc[0] += h[k] * x[k];
+    return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+  }
+
+  uint64_t _l{1};
+  uint64_t _m{1};
+  std::shared_ptr<const Table> _table;
+  std::vector<double> _buf;
+  std::vector<double> _window;
+  uint64_t _buf_start{0};
+  uint64_t _in_count{0};
+  double _first{0.0};
+  uint64_t _i{0};
+  uint64_t _p{0};
+};
+
+}  // namespace autd3::modulation
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <numeric>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "autd3/driver/common/emit_intensity.hpp"
+#include "autd3/driver/common/sampling_config.hpp"
+#include "autd3/driver/datagram/modulation/base.hpp"
+#include "autd3/driver/datagram/modulation/buffer.hpp"
+#include "autd3/driver/datagram/modulation/radiation_pressure.hpp"
+#include "autd3/driver/datagram/modulation/transform.hpp"
+#include "autd3/exception.hpp"
+#include "autd3/modulation/custom.hpp"
+#include "autd3/native_methods.hpp"
+
+namespace autd3::modulation {
+
+/**
+ * @brief Playlist of modulation clips referring to shared buffers
+ * @details Each clip is a slice of a ModulationBuffer, so adding a clip does not copy the data. The clips are concatenated only when the whole
+ * sequence is sent as one modulation, and the result is memoized until a clip is added. Use chunks with autd3::modulation::stream to play the clips
+ * one by one by swapping segments without concatenation.
+ */
+class Sequence final : public driver::ModulationBase<Sequence>,
+                       public driver::IntoRadiationPressure<Sequence>,
+                       public driver::IntoModulationTransform<Sequence> {
+ public:
+  /**
+   * @brief Source of the clips of the sequence for autd3::modulation::stream
+   */
+  class Chunks final {
+   public:
+    explicit Chunks(const Sequence& seq) : _clips(seq._clips), _config(seq._config) {}
+
+    [[nodiscard]] driver::SamplingConfiguration sampling_config() const noexcept { return _config; }
+
+    [[nodiscard]] std::optional<driver::ModulationBuffer> next() {
+      if (_idx >= _clips.size()) return std::nullopt;
+      return _clips[_idx++];
+    }
+
+   private:
+    std::vector<driver::ModulationBuffer> _clips;
+    driver::SamplingConfiguration _config;
+    size_t _idx{0};
+  };
+
+  explicit Sequence(const driver::SamplingConfiguration config) : _config(config) {}
+  Sequence() = delete;                                 // LCOV_EXCL_LINE
+  Sequence(const Sequence& obj) = default;             // LCOV_EXCL_LINE
+  Sequence& operator=(const Sequence& obj) = default;  // LCOV_EXCL_LINE
+  Sequence(Sequence&& obj) = default;                  // LCOV_EXCL_LINE
+  Sequence& operator=(Sequence&& obj) = default;       // LCOV_EXCL_LINE
+  ~Sequence() override = default;                      // LCOV_EXCL_LINE
+
+  /**
+   * @brief Add a clip
+   *
+   * @param clip Modulation data, which must have at least 2 samples
+   */
+  void add(driver::ModulationBuffer clip) & {
+    if (clip.size() < 2) throw AUTDException("Clip must have at least 2 samples");
+    _clips.emplace_back(std::move(clip));
+    _buffer.reset();
+  }
+
+  /**
+   * @brief Add a clip
+   *
+   * @param clip Modulation data, which must have at least 2 samples
+   */
+  [[nodiscard]] Sequence&& add(driver::ModulationBuffer clip) && {
+    add(std::move(clip));
+    return std::move(*this);
+  }
+
+  /**
+   * @brief Add a part of the data held by the modulation such as Cache as a clip
+   *
+   * @param m Modulation whose sampling configuration must be the same as that of the sequence
+   * @param offset Offset of the first sample
+   * @param length Number of samples
+   */
+  template <driver::modulation_with_buffer M>
+  void add(const M& m, const size_t offset, const size_t length) & {
+    if (m.sampling_config() != _config) throw AUTDException("Sampling configuration of the clip must be the same as that of the sequence");
+    add(m.buffer().slice(offset, length));
+  }
+
+  /**
+   * @brief Add a part of the data held by the modulation such as Cache as a clip
+   *
+   * @param m Modulation whose sampling configuration must be the same as that of the sequence
+   * @param offset Offset of the first sample
+   * @param length Number of samples
+   */
+  template <driver::modulation_with_buffer M>
+  [[nodiscard]] Sequence&& add(const M& m, const size_t offset, const size_t length) && {
+    add(m, offset, length);
+    return std::move(*this);
+  }
+
+  /**
+   * @brief Add the whole data held by the modulation such as Cache as a clip
+   */
+  template <driver::modulation_with_buffer M>
+  void add(const M& m) & {
+    add(m, 0, m.buffer().size());
+  }
+
+  /**
+   * @brief Add the whole data held by the modulation such as Cache as a clip
+   */
+  template <driver::modulation_with_buffer M>
+  [[nodiscard]] Sequence&& add(const M& m) && {
+    add(m);
+    return std::move(*this);
+  }
+
+  [[nodiscard]] const std::vector<driver::ModulationBuffer>& clips() const noexcept { return _clips; }
+
+  /**
+   * @brief Get the clip as a modulation without copying the data
+   */
+  [[nodiscard]] Custom operator[](const size_t i) const { return Custom(_clips.at(i), _config); }
+
+  /**
+   * @brief Get the source of the clips for autd3::modulation::stream
+   */
+  [[nodiscard]] Chunks chunks() const { return Chunks(*this); }
+
+  /**
+   * @brief Get the concatenated data
+   * @details If the sequence has only one clip, the clip is returned without copying.
+   */
+  [[nodiscard]] const driver::ModulationBuffer& buffer() const {
+    if (_clips.empty()) throw AUTDException("Sequence has no clip");
+    if (_clips.size() == 1) return _clips.front();
+    if (!_buffer.has_value()) {
+      std::vector<driver::EmitIntensity> data;
+      data.reserve(size());
+      for (const auto& clip : _clips) data.insert(data.end(), clip.begin(), clip.end());
+      _buffer = driver::ModulationBuffer(std::move(data));
+    }
+    return _buffer.value();
+  }
+
+  [[nodiscard]] driver::SamplingConfiguration sampling_config() const override { return _config; }
+
+  [[nodiscard]] size_t size() const override {
+    return std::accumulate(_clips.begin(), _clips.end(), size_t{0}, [](const size_t acc, const auto& clip) { return acc + clip.size(); });
+  }
+
+  [[nodiscard]] native_methods::ModulationPtr modulation_ptr() const override {
+    const auto& buf = buffer();
+    return AUTDModulationCustom(static_cast<native_methods::SamplingConfiguration>(_config), reinterpret_cast<const uint8_t*>(buf.data()),
+                                static_cast<uint64_t>(buf.size()), static_cast<native_methods::LoopBehavior>(_loop_behavior));
+  }
+
+ private:
+  driver::SamplingConfiguration _config;
+  std::vector<driver::ModulationBuffer> _clips;
+  mutable std::optional<driver::ModulationBuffer> _buffer;
+};
+
+}  // namespace autd3::modulation
@@ -1,8 +1,15 @@
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <string>
+#include <vector>
+
 #include "autd3/driver/common/emit_intensity.hpp"
 #include "autd3/driver/common/phase.hpp"
 #include "autd3/driver/datagram/modulation/modulation.hpp"
+#include "autd3/exception.hpp"
 #include "autd3/native_methods.hpp"
 #include "autd3/native_methods/utils.hpp"
 
@@ -38,6 +45,34 @@ class Sine final : public driver::Modulation<Sine> {
 
   friend Fourier operator+(Sine&& lhs, const Sine& rhs);
 
+  /**
+   * @brief Calculate one period of the modulation data on the C++ side
+   * @details The result is the same as that calculated on the native side.
+   */
+  [[nodiscard]] std::vector<driver::EmitIntensity> calc() const {
+    const auto sf = _config.frequency();
+    if (!(_freq > 0.0) || _freq * 2.0 > sf)
+      throw AUTDException("Frequency (" + std::to_string(_freq) + ") is out of range (0, " + std::to_string(sf / 2.0) + "]");
+    uint64_t n = static_cast<uint64_t>(std::round(sf / _freq));
+    uint64_t rep = 1;
+    if (_mode == native_methods::SamplingMode::ExactFrequency) {
+      if (std::floor(_freq) != _freq) throw AUTDException("Frequency (" + std::to_string(_freq) + ") must be integer");
+      if (std::floor(sf) != sf) throw AUTDException("Sampling frequency (" + std::to_string(sf) + ") must be integer");
+      const auto g = std::gcd(static_cast<uint64_t>(sf), static_cast<uint64_t>(_freq));
+      n = static_cast<uint64_t>(sf) / g;
+      rep = static_cast<uint64_t>(_freq) / g;
+    }
+    const auto amp = static_cast<double>(_intensity.value()) / 2.0;
+    const auto offset = static_cast<double>(_offset.value());
+    const auto phase = _phase.radian();
+    std::vector<driver::EmitIntensity> buffer;
+    buffer.reserve(n);
+    for (uint64_t i = 0; i < n; i++)
+      buffer.emplace_back(static_cast<uint8_t>(std::clamp(
+          std::round(amp * std::sin(2.0 * driver::pi * static_cast<double>(rep * i) / static_cast<double>(n) + phase) + offset), 0.0, 255.0)));
+    return buffer;
+  }
+
   [[nodiscard]] native_methods::ModulationPtr modulation_ptr() const override {
     return AUTDModulationSine(_freq, static_cast<native_methods::SamplingConfiguration>(_config), _intensity.value(), _offset.value(), _phase.value(),
                               _mode, static_cast<native_methods::LoopBehavior>(_loop_behavior));
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <chrono>
+#include <concepts>
+#include <optional>
+#include <thread>
+
+#include "autd3/driver/common/loop_behavior.hpp"
+#include "autd3/driver/common/sampling_config.hpp"
+#include "autd3/driver/datagram/modulation/base.hpp"
+#include "autd3/driver/datagram/modulation/buffer.hpp"
+#include "autd3/modulation/custom.hpp"
+#include "autd3/native_methods.hpp"
+
+namespace autd3::modulation {
+
+/**
+ * @brief Source supplying modulation data chunk by chunk
+ * @details `next` returns std::nullopt when the source is exhausted. Each chunk must have at least 2 samples.
+ */
+template <class S>
+concept modulation_chunk_source = requires(S s) {
+  { s.sampling_config() } -> std::same_as<driver::SamplingConfiguration>;
+  { s.next() } -> std::same_as<std::optional<driver::ModulationBuffer>>;
+};
+
+/**
+ * @brief Play modulation data supplied chunk by chunk
+ * @details Each chunk is sent with LoopBehavior::once to the segment which is not being played, and the segment is switched by
+ * ChangeModulationSegment when the previous chunk has been played. The next chunk is prepared while the current one is being played, so only two
+ * chunks are held at a time. This function blocks until the last chunk has been played.
+ *
+ * @param autd Controller
+ * @param source Source of the chunks
+ * @return true if all chunks have been sent successfully
+ */
+template <class C, modulation_chunk_source S>
+bool stream(C& autd, S& source) {
+  auto segment = native_methods::Segment::S0;
+  std::optional<std::chrono::steady_clock::time_point> deadline = std::nullopt;
+  while (auto chunk = source.next()) {
+    const auto config = source.sampling_config();
+    const auto duration =
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(config.period() * static_cast<int64_t>(chunk->size()));
+    auto m = Custom(std::move(chunk.value()), config).with_loop_behavior(driver::LoopBehavior::once());
+    if (deadline.has_value()) {
+      if (!autd.send(std::move(m).with_segment(segment, false))) return false;
+      std::this_thread::sleep_until(deadline.value());
+      if (!autd.send(driver::ChangeModulationSegment(segment))) return false;
+      deadline = deadline.value() + duration;
+    } else {
+      if (!autd.send(std::move(m).with_segment(segment, true))) return false;
+      deadline = std::chrono::steady_clock::now() + duration;
+    }
+    segment = segment == native_methods::Segment::S0 ? native_methods::Segment::S1 : native_methods::Segment::S0;
+  }
+  if (deadline.has_value()) std::this_thread::sleep_until(deadline.value());
+  return true;
+}
+
+}  // namespace autd3::modulation
@@ -0,0 +1,343 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "autd3/def.hpp"
+#include "autd3/driver/common/emit_intensity.hpp"
+#include "autd3/driver/datagram/stm/focus.hpp"
+#include "autd3/exception.hpp"
+#include "autd3/native_methods/utils.hpp"
+
+namespace autd3::stm {
+
+/**
+ * @brief Base class for trajectories of FocusSTM
+ * @details A trajectory is a closed curve, and the points are placed at equal intervals of the arc length, so that the focus moves at a constant
+ * speed including the step from the last point to the first one. The derived class defines `driver::Vector3 position(double t) const` for
+ * `t` in [0, 1), and may define `generate` to place the points directly if `t` is already proportional to the arc length.
+ */
+template <class T>
+class Trajectory {
+ public:
+  /**
+   * @brief Number of samples per point to calculate the arc length
+   */
+  static constexpr size_t OVERSAMPLING = 4;
+
+  /**
+   * @brief Write the points into the buffer
+   *
+   * @param out Buffer of the points. The number of points is the size of the buffer.
+   */
+  void generate(const std::span<driver::Vector3> out) const {
+    const auto n = out.size();
+    if (n == 0) return;
+    const auto& self = static_cast<const T&>(*this);
+
+    const auto m = std::max<size_t>(n * OVERSAMPLING, 1024);
+    std::vector<driver::Vector3> samples(m + 1);
+    for (size_t k = 0; k < m; k++) samples[k] = self.position(static_cast<double>(k) / static_cast<double>(m));
+    samples[m] = samples[0];
+    std::vector<double> length(m + 1);
+    length[0] = 0.0;
+    for (size_t k = 0; k < m; k++) length[k + 1] = length[k] + (samples[k + 1] - samples[k]).norm();
+
+    const auto step = length[m] / static_cast<double>(n);
+    size_t k = 0;
+    for (size_t i = 0; i < n; i++) {
+      const auto s = step * static_cast<double>(i);
+      while (k + 1 < m && length[k + 1] <= s) k++;
+      const auto seg = length[k + 1] - length[k];
+      const auto f = seg > 0.0 ? (s - length[k]) / seg : 0.0;
+      out[i] = self.position((static_cast<double>(k) + f) / static_cast<double>(m));
+    }
+  }
+
+  /**
+   * @brief Get the points
+   *
+   * @param n Number of points
+   */
+  [[nodiscard]] std::vector<driver::Vector3> points(const size_t n) const {
+    std::vector<driver::Vector3> out(n);
+    static_cast<const T&>(*this).generate(out);
+    return out;
+  }
+
+  /**
+   * @brief Add the points to FocusSTM
+   *
+   * @param stm FocusSTM
+   * @param n Number of points
+   * @param intensity Emission intensity
+   */
+  void add_to(driver::FocusSTM& stm, const size_t n, const driver::EmitIntensity intensity = driver::EmitIntensity::maximum()) const {
+    stm.add_foci_from_vec(points(n), std::vector(n, intensity));
+  }
+
+ protected:
+  /**
+   * @brief Orthonormal vectors perpendicular to the normal
+   * @details The derived classes calculate them when the normal is set, not for every position.
+   */
+  [[nodiscard]] static std::pair<driver::Vector3, driver::Vector3> basis(const driver::Vector3& normal) {
+    const driver::Vector3 n = normal.normalized();
+    const driver::Vector3 a = std::abs(n.x()) < 0.9 ? driver::Vector3::UnitX() : driver::Vector3::UnitY();
+    const driver::Vector3 u = (a - n * n.dot(a)).normalized();
+    return {u, n.cross(u)};
+  }
+};
+
+/**
+ * @brief Circle
+ */
+class Circle final : public Trajectory<Circle> {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param center Center of the circle
+   * @param radius Radius of the circle
+   */
+  Circle(driver::Vector3 center, const double radius) : _center(std::move(center)), _radius(radius) { set_normal(driver::Vector3::UnitZ()); }
+
+  AUTD3_DEF_PROP(driver::Vector3, center)
+  AUTD3_DEF_PROP(double, radius)
+
+  void with_normal(const driver::Vector3 value) & { set_normal(value); }
+  [[nodiscard]] Circle&& with_normal(const driver::Vector3 value) && {
+    set_normal(value);
+    return std::move(*this);
+  }
+  [[nodiscard]] driver::Vector3 normal() const { return _normal; }
+
+  [[nodiscard]] driver::Vector3 position(const double t) const {
+    const auto theta = 2.0 * driver::pi * t;
+    return _center + _radius * (std::cos(theta) * _u + std::sin(theta) * _v);
+  }
+
+  void generate(const std::span<driver::Vector3> out) const {
+    const auto step = 2.0 * driver::pi / static_cast<double>(out.size());
+    for (size_t i = 0; i < out.size(); i++) {
+      const auto theta = step * static_cast<double>(i);
+      out[i] = _center + _radius * (std::cos(theta) * _u + std::sin(theta) * _v);
+    }
+  }
+
+ private:
+  void set_normal(const driver::Vector3& normal) {
+    _normal = normal;
+    std::tie(_u, _v) = basis(normal);
+  }
+
+  driver::Vector3 _normal;
+  driver::Vector3 _u;
+  driver::Vector3 _v;
+};
+
+/**
+ * @brief Lissajous curve
+ * @details The position is `center + amp_x sin(2π freq_x t + phase) u + amp_y sin(2π freq_y t) v`, where `u` and `v` are orthonormal vectors
+ * perpendicular to the normal.
+ */
+class Lissajous final : public Trajectory<Lissajous> {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param center Center of the curve
+   * @param amp_x Amplitude along the first axis
+   * @param amp_y Amplitude along the second axis
+   * @param freq_x Number of periods along the first axis
+   * @param freq_y Number of periods along the second axis
+   */
+  Lissajous(driver::Vector3 center, const double amp_x, const double amp_y, const uint32_t freq_x, const uint32_t freq_y)
+      : _center(std::move(center)),
+        _amp_x(amp_x),
+        _amp_y(amp_y),
+        _freq_x(freq_x),
+        _freq_y(freq_y),
+        _phase(0.0) {
+    set_normal(driver::Vector3::UnitZ());
+  }
+
+  AUTD3_DEF_PROP(driver::Vector3, center)
+  AUTD3_DEF_PROP(double, amp_x)
+  AUTD3_DEF_PROP(double, amp_y)
+  AUTD3_DEF_PROP(uint32_t, freq_x)
+  AUTD3_DEF_PROP(uint32_t, freq_y)
+  AUTD3_DEF_PARAM(Lissajous, double, phase)
+
+  void with_normal(const driver::Vector3 value) & { set_normal(value); }
+  [[nodiscard]] Lissajous&& with_normal(const driver::Vector3 value) && {
+    set_normal(value);
+    return std::move(*this);
+  }
+  [[nodiscard]] driver::Vector3 normal() const { return _normal; }
+
+  [[nodiscard]] driver::Vector3 position(const double t) const {
+    return _center + _amp_x * std::sin(2.0 * driver::pi * static_cast<double>(_freq_x) * t + _phase) * _u +
+           _amp_y * std::sin(2.0 * driver::pi * static_cast<double>(_freq_y) * t) * _v;
+  }
+
+ private:
+  void set_normal(const driver::Vector3& normal) {
+    _normal = normal;
+    std::tie(_u, _v) = basis(normal);
+  }
+
+  driver::Vector3 _normal;
+  driver::Vector3 _u;
+  driver::Vector3 _v;
+};
+
+/**
+ * @brief Closed polyline
+ * @details The last vertex is connected to the first one.
+ */
+class Polyline final : public Trajectory<Polyline> {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param vertices Vertices. At least 2 vertices are required.
+   */
+  explicit Polyline(std::vector<driver::Vector3> vertices) : _vertices(std::move(vertices)) {
+    if (_vertices.size() < 2) throw AUTDException("At least 2 vertices are required");
+    _length.reserve(_vertices.size() + 1);
+    _length.emplace_back(0.0);
+    for (size_t i = 0; i < _vertices.size(); i++)
+      _length.emplace_back(_length.back() + (_vertices[(i + 1) % _vertices.size()] - _vertices[i]).norm());
+  }
+
+  [[nodiscard]] const std::vector<driver::Vector3>& vertices() const noexcept { return _vertices; }
+
+  /**
+   * @brief Length of the polyline
+   */
+  [[nodiscard]] double length() const noexcept { return _length.back(); }
+
+  [[nodiscard]] driver::Vector3 position(const double t) const {
+    size_t k = 0;
+    return at(t * length(), k);
+  }
+
+  void generate(const std::span<driver::Vector3> out) const {
+    const auto step = length() / static_cast<double>(out.size());
+    size_t k = 0;
+    for (size_t i = 0; i < out.size(); i++) out[i] = at(step * static_cast<double>(i), k);
+  }
+
+ private:
+  /**
+   * @brief Position at the arc length `s`, where the search of the segment starts from `k`
+   */
+  [[nodiscard]] driver::Vector3 at(const double s, size_t& k) const {
+    while (k + 1 < _vertices.size() && _length[k + 1] <= s) k++;
+    const auto seg = _length[k + 1] - _length[k];
+    const auto f = seg > 0.0 ? (s - _length[k]) / seg : 0.0;
+    return _vertices[k] + f * (_vertices[(k + 1) % _vertices.size()] - _vertices[k]);
+  }
+
+  std::vector<driver::Vector3> _vertices;
+  std::vector<double> _length;
+};
+
+/**
+ * @brief Line segment traversed back and forth
+ */
+class Line final : public Trajectory<Line> {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param start Start point
+   * @param end End point
+   */
+  Line(driver::Vector3 start, driver::Vector3 end) : _start(std::move(start)), _end(std::move(end)) {}
+
+  AUTD3_DEF_PROP(driver::Vector3, start)
+  AUTD3_DEF_PROP(driver::Vector3, end)
+
+  [[nodiscard]] driver::Vector3 position(const double t) const { return _start + (1.0 - std::abs(1.0 - 2.0 * t)) * (_end - _start); }
+
+  void generate(const std::span<driver::Vector3> out) const {
+    const auto step = 1.0 / static_cast<double>(out.size());
+    for (size_t i = 0; i < out.size(); i++) out[i] = position(step * static_cast<double>(i));
+  }
+};
+
+/**
+ * @brief Closed uniform Catmull-Rom spline passing through the keyframes
+ */
+class CatmullRom final : public Trajectory<CatmullRom> {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param keyframes Keyframes. At least 2 keyframes are required.
+   */
+  explicit CatmullRom(std::vector<driver::Vector3> keyframes) : _keyframes(std::move(keyframes)) {
+    if (_keyframes.size() < 2) throw AUTDException("At least 2 keyframes are required");
+  }
+
+  [[nodiscard]] const std::vector<driver::Vector3>& keyframes() const noexcept { return _keyframes; }
+
+  [[nodiscard]] driver::Vector3 position(const double t) const {
+    const auto k = _keyframes.size();
+    const auto u = t * static_cast<double>(k);
+    const auto i = std::min(static_cast<size_t>(u), k - 1);
+    const auto f = u - static_cast<double>(i);
+    const auto& p0 = _keyframes[(i + k - 1) % k];
+    const auto& p1 = _keyframes[i];
+    const auto& p2 = _keyframes[(i + 1) % k];
+    const auto& p3 = _keyframes[(i + 2) % k];
+    return 0.5 * (2.0 * p1 + (p2 - p0) * f + (2.0 * p0 - 5.0 * p1 + 4.0 * p2 - p3) * f * f + (3.0 * (p1 - p2) + p3 - p0) * f * f * f);
+  }
+
+ private:
+  std::vector<driver::Vector3> _keyframes;
+};
+
+/**
+ * @brief Closed uniform cubic B-spline whose control points are the keyframes
+ * @details The curve is smoother than CatmullRom, but does not pass through the keyframes in general.
+ */
+class BSpline final : public Trajectory<BSpline> {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param keyframes Keyframes. At least 2 keyframes are required.
+   */
+  explicit BSpline(std::vector<driver::Vector3> keyframes) : _keyframes(std::move(keyframes)) {
+    if (_keyframes.size() < 2) throw AUTDException("At least 2 keyframes are required");
+  }
+
+  [[nodiscard]] const std::vector<driver::Vector3>& keyframes() const noexcept { return _keyframes; }
+
+  [[nodiscard]] driver::Vector3 position(const double t) const {
+    const auto k = _keyframes.size();
+    const auto u = t * static_cast<double>(k);
+    const auto i = std::min(static_cast<size_t>(u), k - 1);
+    const auto f = u - static_cast<double>(i);
+    const auto g = 1.0 - f;
+    const auto& p0 = _keyframes[(i + k - 1) % k];
+    const auto& p1 = _keyframes[i];
+    const auto& p2 = _keyframes[(i + 1) % k];
+    const auto& p3 = _keyframes[(i + 2) % k];
+    return (g * g * g * p0 + (3.0 * f * f * f - 6.0 * f * f + 4.0) * p1 + (-3.0 * f * f * f + 3.0 * f * f + 3.0 * f + 1.0) * p2 + f * f * f * p3) /
+           6.0;
+  }
+
+ private:
+  std::vector<driver::Vector3> _keyframes;
+};
+
+}  // namespace autd3::stm
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include <autd3/driver/common/spsc_ring_buffer.hpp>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+TEST(DriverCommon, SpscRingBuffer) {
+  autd3::driver::SpscRingBuffer<int> buf(5);
+  ASSERT_EQ(8, buf.capacity());
+  ASSERT_EQ(0, buf.size());
+
+  const std::vector in{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  ASSERT_EQ(8, buf.push(in));
+  ASSERT_EQ(8, buf.size());
+  ASSERT_EQ(0, buf.push(in));
+
+  std::vector<int> out(5);
+  ASSERT_EQ(5, buf.pop(out));
+  ASSERT_EQ((std::vector{0, 1, 2, 3, 4}), out);
+  ASSERT_EQ(5, buf.push(std::span(in).subspan(5)));
+  ASSERT_EQ(5, buf.pop(out));
+  ASSERT_EQ((std::vector{5, 6, 7, 5, 6}), out);
+  ASSERT_EQ(3, buf.pop(out));
+  ASSERT_EQ(7, out[0]);
+  ASSERT_EQ(0, buf.pop(out));
+
+  ASSERT_THROW(autd3::driver::SpscRingBuffer<int>(0), autd3::AUTDException);
+}
+
+TEST(DriverCommon, SpscRingBufferThread) {
+  constexpr size_t N = 10000;
+  autd3::driver::SpscRingBuffer<size_t> buf(64);
+
+  std::thread producer([&buf] {
+    std::vector<size_t> data(N);
+    std::iota(data.begin(), data.end(), 0);
+    for (size_t i = 0; i < N;) {
+      const auto n = buf.push(std::span(data).subspan(i, std::min<size_t>(17, N - i)));
+      if (n == 0) std::this_thread::yield();
+      i += n;
+    }
+  });
+
+  std::vector<size_t> received;
+  std::vector<size_t> out(13);
+  while (received.size() < N) {
+    const auto n = buf.pop(out);
+    if (n == 0) std::this_thread::yield();
+    received.insert(received.end(), out.begin(), out.begin() + static_cast<std::ptrdiff_t>(n));
+  }
+  producer.join();
+
+  for (size_t i = 0; i < N; i++) ASSERT_EQ(i, received[i]);
+}
@@ -63,3 +63,43 @@ TEST(DriverDatagramGain, GainCheckOnlyForEnabled) {
     ASSERT_TRUE(std::ranges::all_of(phases, [](auto p) { return p == 0x90; }));
   }
 }
+
+class PlaneX final : public autd3::gain::Gain<PlaneX> {
+ public:
+  explicit PlaneX(std::vector<bool>* cnt) : _cnt(cnt) {}
+
+  [[nodiscard]] std::unordered_map<size_t, std::vector<autd3::driver::Drive>> calc(const autd3::driver::geometry::Geometry& geometry) const override {
+    return transform_equivariant(
+        geometry,
+        [&](const auto& dev, const auto& tr) {
+          _cnt->operator[](dev.idx()) = true;
+          return std::make_pair(tr.position().x() * tr.wavenumber(dev.sound_speed()), autd3::driver::EmitIntensity::maximum());
+        },
+        [](const auto& ref, const auto& dev) { return (dev.center().x() - ref.center().x()) * dev[0].wavenumber(dev.sound_speed()); });
+  }
+
+ private:
+  std::vector<bool>* _cnt;
+};
+
+TEST(DriverDatagramGain, GainTransformEquivariant) {
+  auto autd = autd3::controller::ControllerBuilder()
+                  .add_device(autd3::driver::AUTD3(autd3::driver::Vector3::Zero()))
+                  .add_device(autd3::driver::AUTD3(autd3::driver::Vector3(autd3::driver::AUTD3::DEVICE_WIDTH, 0, 0)))
+                  .open(autd3::link::Audit::builder());
+
+  std::vector check(autd.geometry().num_devices(), false);
+  ASSERT_TRUE(autd.send(PlaneX(&check)));
+
+  ASSERT_TRUE(check[0]);
+  ASSERT_FALSE(check[1]);
+
+  for (auto& dev : autd.geometry()) {
+    auto [intensities, phases] = autd.link().drives(dev.idx(), autd3::native_methods::Segment::S0, 0);
+    ASSERT_TRUE(std::ranges::all_of(intensities, [](auto d) { return d == 0xFF; }));
+    for (auto& tr : dev) {
+      const auto expect = autd3::driver::Phase::from_rad(tr.position().x() * tr.wavenumber(dev.sound_speed())).value();
+      ASSERT_EQ(expect, phases[tr.idx()]);
+    }
+  }
+}
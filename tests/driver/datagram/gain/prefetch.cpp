@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <autd3/driver/common/emit_intensity.hpp>
+#include <autd3/gain/gain.hpp>
+#include <autd3/gain/uniform.hpp>
+
+#include "utils.hpp"
+
+TEST(DriverDatagramGain, Prefetch) {
+  auto autd = create_controller();
+
+  const auto g = autd3::gain::Uniform(0x80).with_phase(autd3::driver::Phase(0x90)).with_prefetch(autd.geometry());
+  g.wait();
+  ASSERT_TRUE(g.is_ready());
+
+  ASSERT_TRUE(autd.send(g));
+  for (auto& dev : autd.geometry()) {
+    ASSERT_TRUE(std::ranges::all_of(g.drives().at(dev.idx()), [](auto d) { return d == autd3::driver::Drive{autd3::driver::Phase(0x90), 0x80}; }));
+    auto [intensities, phases] = autd.link().drives(dev.idx(), autd3::native_methods::Segment::S0, 0);
+    ASSERT_TRUE(std::ranges::all_of(intensities, [](auto d) { return d == 0x80; }));
+    ASSERT_TRUE(std::ranges::all_of(phases, [](auto p) { return p == 0x90; }));
+  }
+}
+
+class ForPrefetchTest final : public autd3::gain::Gain<ForPrefetchTest> {
+ public:
+  explicit ForPrefetchTest(std::atomic<size_t>* cnt) : _cnt(cnt) {}
+
+  [[nodiscard]] std::unordered_map<size_t, std::vector<autd3::driver::Drive>> calc(const autd3::driver::geometry::Geometry& geometry) const override {
+    ++*_cnt;
+    return transform(geometry, [&](const auto&, const auto&) {
+      return autd3::driver::Drive{autd3::driver::Phase(0x90), autd3::driver::EmitIntensity(0x80)};
+    });
+  }
+
+ private:
+  std::atomic<size_t>* _cnt;
+};
+
+TEST(DriverDatagramGain, PrefetchCheckOnce) {
+  auto autd = create_controller();
+
+  std::atomic<size_t> cnt = 0;
+  const auto g = ForPrefetchTest(&cnt).with_prefetch(autd.geometry());
+  ASSERT_TRUE(autd.send(g));
+  ASSERT_EQ(cnt, 1);
+  ASSERT_TRUE(autd.send(g));
+  ASSERT_EQ(cnt, 1);
+}
+
+TEST(DriverDatagramGain, PrefetchCheckOnlyForEnabled) {
+  auto autd = create_controller();
+  autd.geometry()[0].set_enable(false);
+
+  std::atomic<size_t> cnt = 0;
+  const auto g = ForPrefetchTest(&cnt).with_prefetch(autd.geometry());
+  ASSERT_TRUE(autd.send(g));
+
+  ASSERT_FALSE(g.drives().contains(0));
+  ASSERT_TRUE(g.drives().contains(1));
+}
+
+TEST(DriverDatagramGain, PrefetchDeviceEnabledAfter) {
+  auto autd = create_controller();
+  autd.geometry()[0].set_enable(false);
+
+  std::atomic<size_t> cnt = 0;
+  const auto g = ForPrefetchTest(&cnt).with_prefetch(autd.geometry());
+  g.wait();
+
+  autd.geometry()[0].set_enable(true);
+  ASSERT_THROW((void)g.gain_ptr(autd.geometry()), autd3::AUTDException);
+}
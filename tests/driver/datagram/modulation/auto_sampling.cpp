@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <autd3/modulation/modulation.hpp>
+#include <autd3/modulation/sine.hpp>
+
+#include "utils.hpp"
+
+class ForModulationAutoSamplingTest final : public autd3::modulation::Modulation<ForModulationAutoSamplingTest> {
+ public:
+  [[nodiscard]] std::vector<autd3::driver::EmitIntensity> calc() const override {
+    std::vector<autd3::driver::EmitIntensity> buffer;
+    for (const auto v : _pattern)
+      for (size_t i = 0; i < _hold; i++) buffer.emplace_back(v);
+    return buffer;
+  }
+
+  ForModulationAutoSamplingTest(std::vector<uint8_t> pattern, const size_t hold) noexcept
+      : Modulation(autd3::driver::SamplingConfiguration::from_frequency_division(10240)), _pattern(std::move(pattern)), _hold(hold) {}
+
+ private:
+  std::vector<uint8_t> _pattern;
+  size_t _hold;
+};
+
+TEST(DriverDatagramModulation, AutoSampling) {
+  auto autd = create_controller();
+
+  const auto m = ForModulationAutoSamplingTest({0x00, 0xFF, 0x80}, 4).with_auto_sampling();
+  ASSERT_EQ(3, m.size());
+  ASSERT_EQ(autd3::driver::SamplingConfiguration::from_frequency_division(10240 * 4), m.sampling_config());
+  ASSERT_TRUE(autd.send(m));
+
+  for (auto& dev : autd.geometry()) {
+    auto mod = autd.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+    std::vector<uint8_t> mod_expect{0x00, 0xFF, 0x80};
+    ASSERT_TRUE(std::ranges::equal(mod, mod_expect));
+    ASSERT_EQ(10240 * 4, autd.link().modulation_frequency_division(dev.idx(), autd3::native_methods::Segment::S0));
+    ASSERT_EQ(autd3::driver::LoopBehavior::infinite(), autd.link().modulation_loop_behavior(dev.idx(), autd3::native_methods::Segment::S0));
+  }
+}
+
+TEST(DriverDatagramModulation, AutoSamplingFactor) {
+  using autd3::driver::EmitIntensity;
+  const auto factor = [](const std::vector<uint8_t>& v, const uint8_t tolerance) {
+    std::vector<EmitIntensity> data;
+    std::ranges::transform(v, std::back_inserter(data), [](const uint8_t x) { return EmitIntensity(x); });
+    return autd3::modulation::AutoSampling<ForModulationAutoSamplingTest>::factor(data, 0xFFFFFFFF, tolerance);
+  };
+
+  ASSERT_EQ(2, factor({0x80, 0x80, 0x80, 0x80}, 0));
+  ASSERT_EQ(3, factor({0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF}, 0));
+  ASSERT_EQ(1, factor({0x00, 0x01, 0x02, 0x03}, 0));
+  ASSERT_EQ(2, factor({0x00, 0x01, 0x02, 0x03}, 1));
+  ASSERT_EQ(2, factor({0x00, 0x02, 0x04, 0x06, 0x08, 0x0A}, 1));
+  ASSERT_EQ(3, factor({0x00, 0x02, 0x04, 0x06, 0x08, 0x0A}, 2));
+  ASSERT_EQ(1, factor({0x80, 0x80, 0x80}, 0));
+}
+
+TEST(DriverDatagramModulation, AutoSamplingDecimate) {
+  using autd3::driver::EmitIntensity;
+  const std::vector data{EmitIntensity(0x00), EmitIntensity(0x02), EmitIntensity(0x10), EmitIntensity(0x11)};
+  const auto out = autd3::modulation::AutoSampling<ForModulationAutoSamplingTest>::decimate(data, 2);
+  ASSERT_EQ(2, out.size());
+  ASSERT_EQ(0x01, out[0].value());
+  ASSERT_EQ(0x10, out[1].value());
+}
+
+TEST(DriverDatagramModulation, AutoSamplingSine) {
+  const auto m = autd3::modulation::Sine(150).with_auto_sampling();
+  ASSERT_EQ(80, m.size());
+  ASSERT_EQ(autd3::modulation::Sine(150).sampling_config(), m.sampling_config());
+
+  const auto coarse = autd3::modulation::Sine(150).with_auto_sampling(0xFF);
+  ASSERT_EQ(2, coarse.size());
+  ASSERT_EQ(autd3::modulation::Sine(150).sampling_config().frequency_division() * 40, coarse.sampling_config().frequency_division());
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <autd3/modulation/custom.hpp>
 #include <autd3/modulation/modulation.hpp>
 #include <autd3/modulation/static.hpp>
 
@@ -63,3 +64,38 @@ TEST(DriverDatagramModulation, CacheCheckOnce) {
     ASSERT_EQ(cnt, 1);
   }
 }
+
+TEST(DriverDatagramModulation, CacheShared) {
+  auto autd = create_controller();
+
+  size_t cnt = 0;
+  const auto m1 = ForModulationCacheTest(&cnt).with_cache();
+  const auto m2 = m1;
+
+  ASSERT_TRUE(autd.send(m2));
+  ASSERT_EQ(cnt, 1);
+  ASSERT_EQ(m1.buffer().data(), m2.buffer().data());
+  ASSERT_EQ(cnt, 1);
+
+  const auto m3 = autd3::modulation::Custom(m1.buffer(), autd3::driver::SamplingConfiguration::from_frequency_division(5120));
+  ASSERT_EQ(m1.buffer().data(), m3.buffer().data());
+  ASSERT_TRUE(autd.send(m3));
+  ASSERT_EQ(cnt, 1);
+  for (auto& dev : autd.geometry()) {
+    auto mod = autd.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+    std::vector<uint8_t> mod_expect{0xFF, 0xFF};
+    ASSERT_TRUE(std::ranges::equal(mod, mod_expect));
+  }
+}
+
+TEST(DriverDatagramModulation, CacheMetadata) {
+  auto autd = create_controller();
+
+  size_t cnt = 0;
+  const auto m = ForModulationCacheTest(&cnt).with_cache();
+  ASSERT_EQ(2, m.size());
+  ASSERT_EQ(autd3::driver::SamplingConfiguration::from_frequency_division(5120), m.sampling_config());
+  ASSERT_EQ(cnt, 1);
+  ASSERT_TRUE(autd.send(m));
+  ASSERT_EQ(cnt, 1);
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <autd3/modulation/modulation.hpp>
+#include <autd3/modulation/sine.hpp>
+
+#include "utils.hpp"
+
+class ForModulationCompactTest final : public autd3::modulation::Modulation<ForModulationCompactTest> {
+ public:
+  [[nodiscard]] std::vector<autd3::driver::EmitIntensity> calc() const override {
+    std::vector<autd3::driver::EmitIntensity> buffer;
+    for (size_t i = 0; i < _rep; i++)
+      for (const auto v : _pattern) buffer.emplace_back(v);
+    return buffer;
+  }
+
+  ForModulationCompactTest(std::vector<uint8_t> pattern, const size_t rep) noexcept
+      : Modulation(autd3::driver::SamplingConfiguration::from_frequency_division(10240)), _pattern(std::move(pattern)), _rep(rep) {}
+
+ private:
+  std::vector<uint8_t> _pattern;
+  size_t _rep;
+};
+
+TEST(DriverDatagramModulation, Compact) {
+  auto autd = create_controller();
+
+  const auto m = ForModulationCompactTest({0x00, 0xFF, 0x80}, 100).with_compact();
+  ASSERT_EQ(3, m.size());
+  ASSERT_EQ(autd3::driver::SamplingConfiguration::from_frequency_division(10240), m.sampling_config());
+  ASSERT_TRUE(autd.send(m));
+
+  for (auto& dev : autd.geometry()) {
+    auto mod = autd.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+    std::vector<uint8_t> mod_expect{0x00, 0xFF, 0x80};
+    ASSERT_TRUE(std::ranges::equal(mod, mod_expect));
+    ASSERT_EQ(10240, autd.link().modulation_frequency_division(dev.idx(), autd3::native_methods::Segment::S0));
+    ASSERT_EQ(autd3::driver::LoopBehavior::infinite(), autd.link().modulation_loop_behavior(dev.idx(), autd3::native_methods::Segment::S0));
+  }
+}
+
+TEST(DriverDatagramModulation, CompactOnce) {
+  auto autd = create_controller();
+
+  const auto m = ForModulationCompactTest({0x00, 0xFF, 0x80}, 100).with_compact().with_loop_behavior(autd3::driver::LoopBehavior::once());
+  ASSERT_EQ(300, m.size());
+  ASSERT_TRUE(autd.send(m));
+
+  for (auto& dev : autd.geometry()) {
+    auto mod = autd.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+    ASSERT_EQ(300, mod.size());
+    ASSERT_EQ(0x80, mod[299]);
+    ASSERT_EQ(autd3::driver::LoopBehavior::once(), autd.link().modulation_loop_behavior(dev.idx(), autd3::native_methods::Segment::S0));
+  }
+}
+
+TEST(DriverDatagramModulation, CompactPeriod) {
+  using autd3::driver::EmitIntensity;
+  const auto period = [](const std::vector<uint8_t>& v, const uint8_t tolerance) {
+    std::vector<EmitIntensity> data;
+    std::ranges::transform(v, std::back_inserter(data), [](const uint8_t x) { return EmitIntensity(x); });
+    return autd3::modulation::Compact<ForModulationCompactTest>::period(data, tolerance);
+  };
+
+  ASSERT_EQ(2, period({0x80, 0x80, 0x80, 0x80, 0x80}, 0));
+  ASSERT_EQ(2, period({0x00, 0xFF, 0x00, 0xFF}, 0));
+  ASSERT_EQ(5, period({0x00, 0xFF, 0x00, 0xFF, 0x00}, 0));
+  ASSERT_EQ(4, period({0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02}, 0));
+  ASSERT_EQ(2, period({0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02}, 1));
+  ASSERT_EQ(6, period({10, 200, 11, 201, 10, 200}, 0));
+  ASSERT_EQ(2, period({10, 200, 11, 201, 10, 200}, 1));
+  ASSERT_EQ(1, period({0x80}, 0));
+  ASSERT_EQ(2, period({0x80, 0x80, 0x80}, 1));
+  ASSERT_EQ(2, period({0x80, 0x81, 0x80, 0x7F, 0x80}, 1));
+}
+
+TEST(DriverDatagramModulation, CompactSine) {
+  const auto m = autd3::modulation::Sine(150).with_compact();
+  ASSERT_EQ(80, m.size());
+  ASSERT_EQ(20, autd3::modulation::Sine(200).with_compact().size());
+}
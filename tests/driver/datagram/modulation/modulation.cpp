@@ -27,3 +27,73 @@ TEST(DriverDatagramModulation, Modulation) {
     ASSERT_EQ(5120, autd.link().modulation_frequency_division(dev.idx(), autd3::native_methods::Segment::S0));
   }
 }
+
+class BurstModulationInto final : public autd3::modulation::ModulationInto<BurstModulationInto> {
+ public:
+  [[nodiscard]] size_t required_size() const override { return 10; }
+
+  void calc_into(const std::span<autd3::driver::EmitIntensity> buffer) const override {
+    cnt++;
+    std::ranges::fill(buffer, autd3::driver::EmitIntensity::minimum());
+    buffer[0] = autd3::driver::EmitIntensity::maximum();
+  }
+
+  explicit BurstModulationInto() noexcept : ModulationInto(autd3::driver::SamplingConfiguration::from_frequency_division(5120)) {}
+
+  mutable size_t cnt{0};
+};
+
+TEST(DriverDatagramModulation, ModulationCalcInto) {
+  auto autd = create_controller();
+
+  const BurstModulationInto m;
+  ASSERT_EQ(10, m.size());
+  ASSERT_EQ(0, m.cnt);
+
+  ASSERT_TRUE(autd.send(m));
+  ASSERT_TRUE(autd.send(m));
+  ASSERT_EQ(2, m.cnt);
+
+  for (auto& dev : autd.geometry()) {
+    auto mod = autd.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+    std::vector<uint8_t> mod_expect{255, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    ASSERT_TRUE(std::ranges::equal(mod, mod_expect));
+    ASSERT_EQ(5120, autd.link().modulation_frequency_division(dev.idx(), autd3::native_methods::Segment::S0));
+  }
+
+  const auto buffer = m.calc();
+  ASSERT_EQ(10, buffer.size());
+  ASSERT_EQ(255, buffer[0].value());
+  ASSERT_EQ(3, m.cnt);
+}
+
+class ForModulationSizeTest final : public autd3::modulation::Modulation<ForModulationSizeTest> {
+ public:
+  [[nodiscard]] std::vector<autd3::driver::EmitIntensity> calc() const override {
+    cnt++;
+    return std::vector(10, autd3::driver::EmitIntensity::maximum());
+  }
+
+  explicit ForModulationSizeTest() noexcept : Modulation(autd3::driver::SamplingConfiguration::from_frequency_division(5120)) {}
+
+  mutable size_t cnt{0};
+};
+
+TEST(DriverDatagramModulation, ModulationSize) {
+  auto autd = create_controller();
+
+  ForModulationSizeTest m;
+  ASSERT_EQ(10, m.size());
+  ASSERT_EQ(10, m.size());
+  ASSERT_EQ(1, m.cnt);
+
+  ASSERT_TRUE(autd.send(m));
+  ASSERT_TRUE(autd.send(m));
+  ASSERT_EQ(3, m.cnt);
+  ASSERT_EQ(10, m.size());
+  ASSERT_EQ(3, m.cnt);
+
+  m.with_sampling_config(autd3::driver::SamplingConfiguration::from_frequency_division(10240));
+  ASSERT_EQ(10, m.size());
+  ASSERT_EQ(4, m.cnt);
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <autd3/modulation/sine.hpp>
+#include <cmath>
 
 #include "utils.hpp"
 
@@ -20,3 +21,26 @@ TEST(DriverDatagramModulation, RadiationPressure) {
     ASSERT_EQ(5120, autd.link().modulation_frequency_division(dev.idx(), autd3::native_methods::Segment::S0));
   }
 }
+
+TEST(DriverDatagramModulation, RadiationPressureTable) {
+  static_assert(autd3::modulation::radiation_pressure::TABLE[0] == 0);
+  static_assert(autd3::modulation::radiation_pressure::TABLE[255] == 255);
+  for (size_t v = 0; v < 256; v++)
+    ASSERT_EQ(static_cast<uint8_t>(std::round(std::sqrt(static_cast<double>(v) / 255.0) * 255.0)),
+              autd3::modulation::radiation_pressure::TABLE[v]);
+}
+
+TEST(DriverDatagramModulation, RadiationPressureCache) {
+  auto autd = create_controller();
+
+  const auto m = autd3::modulation::Sine(150).with_radiation_pressure().with_cache();
+  ASSERT_TRUE(autd.send(m));
+  ASSERT_TRUE(autd.send(autd3::modulation::RadiationPressure(autd3::modulation::Sine(150).with_cache())));
+
+  for (auto& dev : autd.geometry()) {
+    auto mod = autd.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+    ASSERT_TRUE(std::ranges::equal(mod, m.buffer(), [](const uint8_t a, const autd3::driver::EmitIntensity b) { return a == b.value(); }));
+    ASSERT_EQ(180, mod[0]);
+    ASSERT_EQ(255, mod[60]);
+  }
+}
@@ -112,3 +112,53 @@ TEST(DriverDatagramSTM, FocusSTMSegment) {
     ASSERT_EQ(Segment::S0, autd.link().current_stm_segment(dev.idx()));
   }
 }
+
+TEST(DriverDatagramSTM, FocusSTMFromSpan) {
+  auto autd = create_controller();
+
+  ASSERT_TRUE(autd.send(autd3::driver::ConfigureSilencer::disable()));
+
+  const autd3::driver::Vector3 center = autd.geometry().center() + autd3::driver::Vector3(0, 0, 150);
+  std::vector<double> points;
+  std::vector<uint8_t> intensities;
+  auto expect = autd3::driver::FocusSTM::from_freq(1).reserve(4);
+  for (int i = 0; i < 4; i++) {
+    const autd3::driver::Vector3 p = center + autd3::driver::Vector3(10.0 * i, 0, 0);
+    points.insert(points.end(), {p.x(), p.y(), p.z()});
+    intensities.emplace_back(static_cast<uint8_t>(0xFF - i));
+    expect.add_focus(p, autd3::driver::EmitIntensity(static_cast<uint8_t>(0xFF - i)));
+  }
+
+  const auto drives = [&](const autd3::driver::FocusSTM& stm) {
+    EXPECT_TRUE(autd.send(stm));
+    std::vector<std::pair<std::vector<uint8_t>, std::vector<uint8_t>>> res;
+    for (const auto& dev : autd.geometry())
+      for (int i = 0; i < static_cast<int>(autd.link().stm_cycle(dev.idx(), Segment::S0)); i++)
+        res.emplace_back(autd.link().drives(dev.idx(), Segment::S0, i));
+    return res;
+  };
+
+  const auto expect_drives = drives(expect);
+  ASSERT_EQ(expect_drives, drives(autd3::driver::FocusSTM::from_freq(1).add_foci_from_span(points, intensities)));
+  ASSERT_EQ(expect_drives, drives(autd3::driver::FocusSTM::from_freq(1)
+                                      .add_foci_from_span(std::span(points).first(6), std::span(intensities).first(2))
+                                      .add_foci_from_span(std::span(points).subspan(6), std::span(intensities).subspan(2))));
+
+  std::vector<autd3::driver::Vector3> vs;
+  std::vector<autd3::driver::EmitIntensity> is;
+  for (size_t i = 0; i < 4; i++) {
+    vs.emplace_back(points[3 * i], points[3 * i + 1], points[3 * i + 2]);
+    is.emplace_back(intensities[i]);
+  }
+  ASSERT_EQ(expect_drives, drives(autd3::driver::FocusSTM::from_freq(1).add_foci_from_vec(vs, is)));
+  ASSERT_EQ(expect_drives, drives(autd3::driver::FocusSTM::from_freq(1)
+                                      .add_focus(vs[0], is[0])
+                                      .add_foci_from_vec({vs.begin() + 1, vs.end()}, {is.begin() + 1, is.end()})));
+
+  ASSERT_EQ(drives(autd3::driver::FocusSTM::from_freq(1).add_foci_from_iter(vs)),
+            drives(autd3::driver::FocusSTM::from_freq(1).add_foci_from_span(points)));
+
+  ASSERT_THROW((void)autd3::driver::FocusSTM::from_freq(1).add_foci_from_span(points, std::span(intensities).first(3)), autd3::AUTDException);
+  ASSERT_THROW((void)autd3::driver::FocusSTM::from_freq(1).add_foci_from_span(std::span(points).first(5)), autd3::AUTDException);
+  ASSERT_THROW((void)autd3::driver::FocusSTM::from_freq(1).add_foci_from_vec(vs, {}), autd3::AUTDException);
+}
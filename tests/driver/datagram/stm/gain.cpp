@@ -87,6 +87,34 @@ TEST(DriverDatagramSTM, GainSTM) {
   }
 }
 
+TEST(DriverDatagramSTM, GainSTMStatic) {
+  auto autd = create_controller();
+
+  ASSERT_TRUE(autd.send(autd3::driver::ConfigureSilencer::disable()));
+
+  autd3::driver::Vector3 center = autd.geometry().center() + autd3::driver::Vector3(0, 0, 150);
+  std::vector<autd3::gain::Focus> foci;
+  for (int i = 0; i < 2; i++) foci.emplace_back(center);
+  auto stm = autd3::driver::BasicGainSTM<autd3::gain::Focus, autd3::gain::Uniform>::from_sampling_config(
+                 autd3::driver::SamplingConfiguration::from_frequency_division(512))
+                 .add_gains_from_iter(foci)
+                 .add_gain(autd3::gain::Uniform(0x80));
+  ASSERT_TRUE(autd.send(stm));
+  ASSERT_EQ(512u, stm.sampling_config().frequency_division());
+
+  for (const auto& dev : autd.geometry()) {
+    ASSERT_TRUE(autd.link().is_stm_gain_mode(dev.idx(), autd3::native_methods::Segment::S0));
+    ASSERT_EQ(3u, autd.link().stm_cycle(dev.idx(), autd3::native_methods::Segment::S0));
+    auto [intensities, phases] = autd.link().drives(dev.idx(), autd3::native_methods::Segment::S0, 0);
+    ASSERT_TRUE(std::ranges::all_of(intensities, [](auto d) { return d == 0xFF; }));
+    ASSERT_TRUE(std::ranges::any_of(phases, [](auto p) { return p != 0; }));
+
+    std::tie(intensities, phases) = autd.link().drives(dev.idx(), autd3::native_methods::Segment::S0, 2);
+    ASSERT_TRUE(std::ranges::all_of(intensities, [](auto d) { return d == 0x80; }));
+    ASSERT_TRUE(std::ranges::all_of(phases, [](auto p) { return p == 0; }));
+  }
+}
+
 TEST(DriverDatagramSTM, GainSTMSegment) {
   auto autd = create_controller();
 
@@ -48,6 +48,40 @@ TEST(Gain, Group) {
   }
 }
 
+TEST(Gain, GroupStatic) {
+  auto autd = create_controller();
+
+  const auto cx = autd.geometry().center().x();
+
+  const auto f = [cx](const auto&, const auto& tr) -> std::optional<int> { return tr.position().x() < cx ? 0 : 1; };
+  auto g = autd3::gain::Group<decltype(f), autd3::gain::Uniform, autd3::gain::Null>(f)
+               .set(0, autd3::gain::Uniform(0x80).with_phase(autd3::driver::Phase(0x90)))
+               .set(1, autd3::gain::Null());
+  ASSERT_TRUE(autd.send(g));
+  for (auto& dev : autd.geometry()) {
+    auto [intensities, phases] = autd.link().drives(dev.idx(), autd3::native_methods::Segment::S0, 0);
+    for (auto& tr : dev) {
+      if (tr.position().x() < cx) {
+        ASSERT_EQ(0x80, intensities[tr.idx()]);
+        ASSERT_EQ(0x90, phases[tr.idx()]);
+      } else {
+        ASSERT_EQ(0, intensities[tr.idx()]);
+        ASSERT_EQ(0, phases[tr.idx()]);
+      }
+    }
+  }
+
+  g.set(1, autd3::gain::Uniform(0x81).with_phase(autd3::driver::Phase(0x91)));
+  ASSERT_TRUE(autd.send(g));
+  for (auto& dev : autd.geometry()) {
+    auto [intensities, phases] = autd.link().drives(dev.idx(), autd3::native_methods::Segment::S0, 0);
+    for (auto& tr : dev) {
+      ASSERT_EQ(tr.position().x() < cx ? 0x80 : 0x81, intensities[tr.idx()]);
+      ASSERT_EQ(tr.position().x() < cx ? 0x90 : 0x91, phases[tr.idx()]);
+    }
+  }
+}
+
 TEST(Gain, GroupUnkownKey) {
   auto autd = create_controller();
 
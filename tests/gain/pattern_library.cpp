@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include <autd3/gain/focus.hpp>
+#include <autd3/gain/pattern_library.hpp>
+#include <autd3/gain/uniform.hpp>
+#include <filesystem>
+
+#include "utils.hpp"
+
+TEST(Gain, PatternLibrary) {
+  auto autd = create_controller();
+
+  const auto path = std::filesystem::temp_directory_path() / "autd3_test_pattern_library.bin";
+  autd3::gain::PatternLibraryWriter(autd.geometry())
+      .add(autd3::gain::Uniform(0x80).with_phase(autd3::driver::Phase(0x90)))
+      .add(autd3::gain::Focus(autd.geometry().center() + autd3::driver::Vector3(0, 0, 150)))
+      .write(path);
+
+  {
+    const auto lib = autd3::gain::PatternLibrary::open(path, autd.geometry());
+    ASSERT_EQ(2, lib.size());
+
+    const auto p = lib[0];
+    ASSERT_TRUE(autd.send(p));
+    for (auto& dev : autd.geometry()) {
+      ASSERT_TRUE(std::ranges::all_of(p[dev], [](auto d) { return d == autd3::driver::Drive{autd3::driver::Phase(0x90), 0x80}; }));
+      auto [intensities, phases] = autd.link().drives(dev.idx(), autd3::native_methods::Segment::S0, 0);
+      ASSERT_TRUE(std::ranges::all_of(intensities, [](auto d) { return d == 0x80; }));
+      ASSERT_TRUE(std::ranges::all_of(phases, [](auto p) { return p == 0x90; }));
+    }
+
+    ASSERT_TRUE(autd.send(lib[1]));
+    for (auto& dev : autd.geometry()) {
+      auto [intensities, phases] = autd.link().drives(dev.idx(), autd3::native_methods::Segment::S0, 0);
+      ASSERT_TRUE(std::ranges::all_of(intensities, [](auto d) { return d == 0xFF; }));
+      ASSERT_TRUE(std::ranges::any_of(phases, [](auto p) { return p != 0; }));
+    }
+
+    ASSERT_THROW((void)lib[2], std::out_of_range);
+  }
+
+  std::filesystem::remove(path);
+}
+
+TEST(Gain, PatternLibraryGeometryMismatch) {
+  auto autd = create_controller();
+
+  const auto path = std::filesystem::temp_directory_path() / "autd3_test_pattern_library_mismatch.bin";
+  autd3::gain::PatternLibraryWriter(autd.geometry()).add(autd3::gain::Uniform(0x80)).write(path);
+
+  autd.geometry()[0].set_enable(false);
+  ASSERT_THROW((void)autd3::gain::PatternLibrary::open(path, autd.geometry()), autd3::AUTDException);
+
+  std::filesystem::remove(path);
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <autd3/gain/sparse.hpp>
+#include <ranges>
+
+#include "utils.hpp"
+
+TEST(Gain, Sparse) {
+  auto autd = create_controller();
+
+  auto g = autd3::gain::Sparse()
+               .set(0, 0, autd3::driver::Drive(autd3::driver::Phase(0x90), 0x80))
+               .set(1, 248, autd3::driver::Drive(autd3::driver::Phase(0x91), 0x81));
+  ASSERT_EQ(2, g.size());
+  ASSERT_TRUE(autd.send(g));
+
+  {
+    auto [intensities, phases] = autd.link().drives(0, autd3::native_methods::Segment::S0, 0);
+    ASSERT_EQ(0x80, intensities[0]);
+    ASSERT_EQ(0x90, phases[0]);
+    ASSERT_TRUE(std::ranges::all_of(intensities | std::ranges::views::drop(1), [](auto d) { return d == 0; }));
+    ASSERT_TRUE(std::ranges::all_of(phases | std::ranges::views::drop(1), [](auto p) { return p == 0; }));
+  }
+
+  {
+    auto [intensities, phases] = autd.link().drives(1, autd3::native_methods::Segment::S0, 0);
+    const auto idx = autd.geometry()[1].num_transducers() - 1;
+    ASSERT_EQ(0x81, intensities[idx]);
+    ASSERT_EQ(0x91, phases[idx]);
+    ASSERT_TRUE(std::ranges::all_of(intensities | std::ranges::views::take(idx), [](auto d) { return d == 0; }));
+    ASSERT_TRUE(std::ranges::all_of(phases | std::ranges::views::take(idx), [](auto p) { return p == 0; }));
+  }
+}
+
+TEST(Gain, SparseDefaultDrive) {
+  auto autd = create_controller();
+
+  auto g = autd3::gain::Sparse(autd3::driver::Drive(autd3::driver::Phase(0x10), 0x20));
+  g.set(autd.geometry()[0], autd.geometry()[0][1], autd3::driver::Drive(autd3::driver::Phase(0x90), 0x80));
+  g.set(autd.geometry()[0], autd.geometry()[0][1], autd3::driver::Drive(autd3::driver::Phase(0x91), 0x81));
+  ASSERT_EQ(1, g.size());
+  ASSERT_TRUE(autd.send(g));
+
+  {
+    auto [intensities, phases] = autd.link().drives(0, autd3::native_methods::Segment::S0, 0);
+    ASSERT_EQ(0x81, intensities[1]);
+    ASSERT_EQ(0x91, phases[1]);
+    ASSERT_EQ(0x20, intensities[0]);
+    ASSERT_EQ(0x10, phases[0]);
+  }
+  {
+    auto [intensities, phases] = autd.link().drives(1, autd3::native_methods::Segment::S0, 0);
+    ASSERT_TRUE(std::ranges::all_of(intensities, [](auto d) { return d == 0x20; }));
+    ASSERT_TRUE(std::ranges::all_of(phases, [](auto p) { return p == 0x10; }));
+  }
+}
+
+TEST(Gain, SparseOutOfRange) {
+  auto autd = create_controller();
+
+  auto g = autd3::gain::Sparse().set(0, 249, autd3::driver::Drive(autd3::driver::Phase(0x90), 0x80));
+  ASSERT_THROW((void)g.gain_ptr(autd.geometry()), autd3::AUTDException);
+}
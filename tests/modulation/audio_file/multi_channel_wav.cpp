@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstring>
+#include <fstream>
+
+#include "autd3/modulation/audio_file.hpp"
+#include "utils.hpp"
+
+namespace {
+void write_stereo_wav(const std::filesystem::path& path, const std::vector<int16_t>& interleaved) {
+  const auto data_size = static_cast<uint32_t>(interleaved.size() * sizeof(int16_t));
+  std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+  const auto u32 = [&ofs](const uint32_t v) { ofs.write(reinterpret_cast<const char*>(&v), 4); };
+  const auto u16 = [&ofs](const uint16_t v) { ofs.write(reinterpret_cast<const char*>(&v), 2); };
+  ofs.write("RIFF", 4);
+  u32(36 + data_size);
+  ofs.write("WAVEfmt ", 8);
+  u32(16);
+  u16(1);
+  u16(2);
+  u32(4000);
+  u32(4000 * 4);
+  u16(4);
+  u16(16);
+  ofs.write("data", 4);
+  u32(data_size);
+  ofs.write(reinterpret_cast<const char*>(interleaved.data()), data_size);
+}
+}  // namespace
+
+TEST(Modulation, MultiChannelWav) {
+  auto autd = create_controller();
+
+  const auto path = std::filesystem::temp_directory_path() / "autd3_test_multi_channel.wav";
+  write_stereo_wav(path, {-32768, 32767, 32767, 32767, -32768, -32768, 32767, -32768});
+
+  {
+    const autd3::modulation::audio_file::MultiChannelWav wav(path);
+    ASSERT_EQ(2, wav.channels());
+    ASSERT_EQ(autd3::driver::SamplingConfiguration::from_frequency(4e3), wav.sampling_config());
+    ASSERT_EQ(wav.buffer(0).use_count(), wav.buffer(1).use_count());
+    ASSERT_EQ(wav.buffer(0).data() + 4, wav.buffer(1).data());
+
+    ASSERT_TRUE(autd.group([](auto& dev) -> std::optional<size_t> { return dev.idx(); }).set(0, wav[0]).set(1, wav[1]).send());
+
+    std::vector<uint8_t> expect0{0, 255, 0, 255};
+    std::vector<uint8_t> expect1{255, 255, 0, 0};
+    ASSERT_EQ(expect0, autd.link().modulation(0, autd3::native_methods::Segment::S0));
+    ASSERT_EQ(expect1, autd.link().modulation(1, autd3::native_methods::Segment::S0));
+
+    ASSERT_THROW((void)wav[2], std::out_of_range);
+  }
+
+  std::filesystem::remove(path);
+}
+
+TEST(Modulation, MultiChannelWavMono) {
+  const std::filesystem::path path = std::filesystem::path(AUTD3_RESOURCE_PATH).append("sin150.wav");
+  const autd3::modulation::audio_file::MultiChannelWav wav(path);
+  ASSERT_EQ(1, wav.channels());
+
+  const auto [buf, config] = autd3::driver::calc_modulation(autd3::modulation::audio_file::Wav(path));
+  ASSERT_EQ(config, wav.sampling_config());
+  ASSERT_TRUE(std::ranges::equal(buf, wav.buffer(0)));
+}
@@ -24,6 +24,37 @@ TEST(Modulation, RawPCM) {
   for (auto& dev : autd.geometry()) ASSERT_EQ(10240, autd.link().modulation_frequency_division(dev.idx(), autd3::native_methods::Segment::S0));
 }
 
+TEST(Modulation, MappedRawPCM) {
+  auto autd1 = create_controller();
+  auto autd2 = create_controller();
+
+  const std::filesystem::path path = std::filesystem::path(AUTD3_RESOURCE_PATH).append("sin150.dat");
+  const auto m = autd3::modulation::audio_file::MappedRawPCM(path, 4000);
+  ASSERT_EQ(80, m.length());
+  ASSERT_EQ(80, m.size());
+  ASSERT_TRUE(autd1.send(autd3::modulation::audio_file::RawPCM(path, 4000)));
+  ASSERT_TRUE(autd2.send(m));
+  for (auto& dev : autd1.geometry()) {
+    auto mod = autd2.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+    auto mod_expect = autd1.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+    ASSERT_TRUE(std::ranges::equal(mod, mod_expect));
+    ASSERT_EQ(5120, autd2.link().modulation_frequency_division(dev.idx(), autd3::native_methods::Segment::S0));
+  }
+
+  const auto s = m.slice(10, 40).slice(10, 20);
+  ASSERT_EQ(20, s.offset());
+  ASSERT_EQ(20, s.length());
+  ASSERT_TRUE(autd2.send(s));
+  for (auto& dev : autd1.geometry()) {
+    auto mod = autd2.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+    auto mod_expect = autd1.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+    ASSERT_TRUE(std::ranges::equal(mod, std::vector(mod_expect.begin() + 20, mod_expect.begin() + 40)));
+  }
+
+  ASSERT_EQ(10, s.slice(0, 20).with_sampling_config(autd3::driver::SamplingConfiguration::from_frequency_division(10240)).size());
+  ASSERT_THROW((void)m.slice(70, 11), std::out_of_range);
+}
+
 TEST(Modulation, RawPCMDefault) {
   const auto m = autd3::modulation::audio_file::RawPCM(std::filesystem::path(""), 4000);
   ASSERT_TRUE(AUTDModulationRawPCMIsDefault(m.modulation_ptr()));
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include "autd3/modulation/audio_file.hpp"
+#include "autd3/modulation/stream.hpp"
+#include "utils.hpp"
+
+static const std::vector<uint8_t> SIN150{128, 157, 185, 210, 230, 245, 253, 254, 248, 236, 217, 194, 167, 137, 109, 80,  54,  32,  15,  5,
+                                         1,   5,   15,  32,  54,  80,  109, 137, 167, 194, 217, 236, 248, 254, 253, 245, 230, 210, 185, 157,
+                                         128, 99,  71,  46,  26,  11,  3,   2,   8,   20,  39,  62,  89,  119, 147, 176, 202, 224, 241, 251,
+                                         255, 251, 241, 224, 202, 176, 147, 119, 89,  62,  39,  20,  8,   2,   3,   11,  26,  46,  71,  99};
+
+TEST(Modulation, WavReader) {
+  auto reader = autd3::modulation::audio_file::WavReader(std::filesystem::path(AUTD3_RESOURCE_PATH).append("sin150.wav"));
+  ASSERT_EQ(1, reader.channels());
+  ASSERT_EQ(4000, reader.sample_rate());
+  ASSERT_EQ(8, reader.bits_per_sample());
+  ASSERT_EQ(80, reader.num_frames());
+
+  std::vector<double> buf(50);
+  ASSERT_EQ(50, reader.read(buf));
+  ASSERT_EQ(30, reader.read(buf));
+  ASSERT_EQ(0, reader.read(buf));
+  ASSERT_EQ(80, reader.position());
+
+  reader.seek(1);
+  ASSERT_EQ(1, reader.read(std::span(buf.data(), 1)));
+  ASSERT_DOUBLE_EQ(157.0 / 255.0, buf[0]);
+}
+
+TEST(Modulation, WavStream) {
+  auto source = autd3::modulation::audio_file::WavStream(std::filesystem::path(AUTD3_RESOURCE_PATH).append("sin150.wav"), 32);
+  ASSERT_EQ(autd3::driver::SamplingConfiguration::from_frequency(4e3), source.sampling_config());
+
+  std::vector<size_t> sizes;
+  std::vector<uint8_t> data;
+  while (auto chunk = source.next()) {
+    sizes.emplace_back(chunk->size());
+    std::ranges::transform(*chunk, std::back_inserter(data), [](const autd3::driver::EmitIntensity v) { return v.value(); });
+  }
+  ASSERT_EQ((std::vector<size_t>{32, 32, 16}), sizes);
+  ASSERT_EQ(SIN150, data);
+}
+
+TEST(Modulation, WavStreamResample) {
+  auto source = autd3::modulation::audio_file::WavStream(std::filesystem::path(AUTD3_RESOURCE_PATH).append("sin150.wav"), 7,
+                                                          autd3::driver::SamplingConfiguration::from_frequency_division(10240));
+
+  std::vector<uint8_t> data;
+  while (auto chunk = source.next())
+    std::ranges::transform(*chunk, std::back_inserter(data), [](const autd3::driver::EmitIntensity v) { return v.value(); });
+  ASSERT_EQ(40, data.size());
+  for (size_t i = 0; i < data.size(); i++) ASSERT_NEAR(SIN150[2 * i], data[i], 5);
+}
+
+TEST(Modulation, WavStreamInvalidChunkSize) {
+  ASSERT_THROW(autd3::modulation::audio_file::WavStream(std::filesystem::path(AUTD3_RESOURCE_PATH).append("sin150.wav"), 1),
+               autd3::AUTDException);
+}
+
+TEST(Modulation, Stream) {
+  auto autd = create_controller();
+
+  auto source = autd3::modulation::audio_file::WavStream(std::filesystem::path(AUTD3_RESOURCE_PATH).append("sin150.wav"), 32);
+  ASSERT_TRUE(autd3::modulation::stream(autd, source));
+
+  for (auto& dev : autd.geometry()) {
+    ASSERT_EQ(autd3::native_methods::Segment::S0, autd.link().current_mod_segment(dev.idx()));
+    auto mod0 = autd.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+    ASSERT_TRUE(std::ranges::equal(mod0, std::vector(SIN150.begin() + 64, SIN150.end())));
+    auto mod1 = autd.link().modulation(dev.idx(), autd3::native_methods::Segment::S1);
+    ASSERT_TRUE(std::ranges::equal(mod1, std::vector(SIN150.begin() + 32, SIN150.begin() + 64)));
+    ASSERT_EQ(autd3::driver::LoopBehavior::once(), autd.link().modulation_loop_behavior(dev.idx(), autd3::native_methods::Segment::S0));
+    ASSERT_EQ(autd3::driver::LoopBehavior::once(), autd.link().modulation_loop_behavior(dev.idx(), autd3::native_methods::Segment::S1));
+  }
+}
@@ -24,6 +24,18 @@ TEST(Modulation, Wav) {
   for (auto& dev : autd.geometry()) ASSERT_EQ(10240, autd.link().modulation_frequency_division(dev.idx(), autd3::native_methods::Segment::S0));
 }
 
+TEST(Modulation, WavSize) {
+  const std::filesystem::path path = std::filesystem::path(AUTD3_RESOURCE_PATH).append("sin150.wav");
+  auto m = autd3::modulation::audio_file::Wav(path);
+  ASSERT_EQ(80, m.size());
+  ASSERT_EQ(80, m.size());
+  ASSERT_EQ(autd3::driver::SamplingConfiguration::from_frequency_division(5120), m.sampling_config());
+
+  m.with_sampling_config(autd3::driver::SamplingConfiguration::from_frequency_division(10240));
+  ASSERT_EQ(40, m.size());
+  ASSERT_EQ(autd3::driver::SamplingConfiguration::from_frequency_division(10240), m.sampling_config());
+}
+
 TEST(Modulation, WavDefault) {
   const auto m = autd3::modulation::audio_file::Wav(std::filesystem::path(""));
   ASSERT_TRUE(AUTDModulationWavIsDefault(m.modulation_ptr()));
@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+
+#include <autd3/modulation/custom.hpp>
+#include <autd3/modulation/sine.hpp>
+
+#include "utils.hpp"
+
+TEST(Modulation, Custom) {
+  auto autd = create_controller();
+
+  const autd3::driver::ModulationBuffer buf(std::vector{autd3::driver::EmitIntensity(0x00), autd3::driver::EmitIntensity(0x40),
+                                                        autd3::driver::EmitIntensity(0x80), autd3::driver::EmitIntensity(0xFF)});
+  const auto m = autd3::modulation::Custom(buf.slice(1, 3), autd3::driver::SamplingConfiguration::from_frequency_division(10240));
+  ASSERT_EQ(buf.data() + 1, m.buffer().data());
+  ASSERT_EQ(3, buf.use_count());
+
+  ASSERT_TRUE(autd.send(m));
+
+  for (auto& dev : autd.geometry()) {
+    auto mod = autd.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+    std::vector<uint8_t> mod_expect{0x40, 0x80, 0xFF};
+    ASSERT_TRUE(std::ranges::equal(mod, mod_expect));
+    ASSERT_EQ(10240, autd.link().modulation_frequency_division(dev.idx(), autd3::native_methods::Segment::S0));
+  }
+}
+
+TEST(Modulation, CustomSliceOutOfRange) {
+  const autd3::driver::ModulationBuffer buf(std::vector{autd3::driver::EmitIntensity(0x00), autd3::driver::EmitIntensity(0xFF)});
+  ASSERT_EQ(2, buf.slice(0, 2).size());
+  ASSERT_TRUE(buf.slice(2, 0).empty());
+  ASSERT_THROW((void)buf.slice(1, 2), std::out_of_range);
+  ASSERT_THROW((void)buf.slice(3, 0), std::out_of_range);
+}
+
+TEST(Modulation, CustomFromCalc) {
+  auto autd1 = create_controller();
+  auto autd2 = create_controller();
+
+  const auto m = autd3::modulation::Sine(150);
+  const auto [buf, config] = autd3::driver::calc_modulation(m);
+
+  ASSERT_TRUE(autd1.send(m));
+  ASSERT_TRUE(autd2.send(autd3::modulation::Custom(buf, config)));
+
+  for (auto& dev : autd1.geometry()) {
+    auto mod = autd2.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+    auto mod_expect = autd1.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+    ASSERT_TRUE(std::ranges::equal(mod, mod_expect));
+    ASSERT_EQ(autd1.link().modulation_frequency_division(dev.idx(), autd3::native_methods::Segment::S0),
+              autd2.link().modulation_frequency_division(dev.idx(), autd3::native_methods::Segment::S0));
+  }
+}
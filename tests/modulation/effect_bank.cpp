@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <autd3/modulation/effect_bank.hpp>
+#include <autd3/modulation/sine.hpp>
+#include <autd3/modulation/square.hpp>
+#include <filesystem>
+#include <fstream>
+
+#include "utils.hpp"
+
+TEST(Modulation, EffectBank) {
+  auto autd = create_controller();
+
+  const auto path = std::filesystem::temp_directory_path() / "autd3_test_effect_bank.bin";
+  autd3::modulation::EffectBankWriter()
+      .add(autd3::modulation::Sine(150))
+      .add(autd3::modulation::Square(200)
+               .with_sampling_config(autd3::driver::SamplingConfiguration::from_frequency_division(10240))
+               .with_loop_behavior(autd3::driver::LoopBehavior::finite(3)))
+      .add(autd3::modulation::Sine(100).with_loop_behavior(autd3::driver::LoopBehavior::once()))
+      .write(path);
+
+  {
+    const auto bank = autd3::modulation::EffectBank::open(path);
+    ASSERT_EQ(3, bank.size());
+
+    const auto e = bank[0];
+    ASSERT_EQ(autd3::driver::LoopBehavior::infinite(), e.loop_behavior());
+    ASSERT_TRUE(autd.send(e));
+    const auto [buf, config] = autd3::driver::calc_modulation(autd3::modulation::Sine(150));
+    for (auto& dev : autd.geometry()) {
+      auto mod = autd.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+      ASSERT_TRUE(std::ranges::equal(mod, buf, [](const uint8_t a, const autd3::driver::EmitIntensity b) { return a == b.value(); }));
+      ASSERT_EQ(config.frequency_division(), autd.link().modulation_frequency_division(dev.idx(), autd3::native_methods::Segment::S0));
+    }
+
+    const auto sq = bank[1];
+    ASSERT_EQ(10240, sq.sampling_config().frequency_division());
+    ASSERT_EQ(autd3::driver::LoopBehavior::finite(3), sq.loop_behavior());
+    ASSERT_EQ(autd3::driver::calc_modulation(autd3::modulation::Square(200).with_sampling_config(
+                                                 autd3::driver::SamplingConfiguration::from_frequency_division(10240)))
+                  .first.size(),
+              sq.size());
+    ASSERT_TRUE(autd.send(sq));
+    for (auto& dev : autd.geometry())
+      ASSERT_EQ(autd3::driver::LoopBehavior::finite(3),
+                autd.link().modulation_loop_behavior(dev.idx(), autd3::native_methods::Segment::S0));
+
+    ASSERT_EQ(autd3::driver::LoopBehavior::once(), bank[2].loop_behavior());
+
+    ASSERT_THROW((void)bank[3], std::out_of_range);
+  }
+
+  std::filesystem::remove(path);
+}
+
+TEST(Modulation, EffectBankInvalid) {
+  const auto path = std::filesystem::temp_directory_path() / "autd3_test_effect_bank_invalid.bin";
+  {
+    std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+    ofs << "AUTD3GPL";
+  }
+  ASSERT_THROW((void)autd3::modulation::EffectBank::open(path), autd3::AUTDException);
+  std::filesystem::remove(path);
+}
@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+
+#include <autd3/modulation/fixed.hpp>
+#include <autd3/modulation/sine.hpp>
+#include <autd3/modulation/square.hpp>
+
+#include "utils.hpp"
+
+TEST(Modulation, FixedSine) {
+  auto autd = create_controller();
+
+  static_assert(autd3::modulation::FixedSine<150>::TABLE.size() == 80);
+  static_assert(autd3::modulation::FixedSine<150>::TABLE[0].value() == 127);
+
+  const autd3::modulation::FixedSine<150> m;
+  ASSERT_EQ(80, m.size());
+  ASSERT_EQ(autd3::modulation::Sine(150).sampling_config(), m.sampling_config());
+  ASSERT_TRUE(std::ranges::equal(autd3::modulation::Sine(150).calc(), m.buffer()));
+  ASSERT_TRUE(autd.send(m));
+  for (auto& dev : autd.geometry()) {
+    auto mod = autd.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+    ASSERT_TRUE(std::ranges::equal(mod, m.buffer(), [](const uint8_t a, const autd3::driver::EmitIntensity b) { return a == b.value(); }));
+    ASSERT_EQ(5120, autd.link().modulation_frequency_division(dev.idx(), autd3::native_methods::Segment::S0));
+  }
+
+  const auto [buf, config] = autd3::driver::calc_modulation(
+      autd3::modulation::Sine(200).with_sampling_config(autd3::driver::SamplingConfiguration::from_frequency_division(10240)));
+  const autd3::modulation::FixedSine<200, 10240> m2;
+  ASSERT_TRUE(std::ranges::equal(buf, m2.buffer()));
+  ASSERT_EQ(config, m2.sampling_config());
+}
+
+TEST(Modulation, FixedSquare) {
+  auto autd = create_controller();
+
+  const auto m = autd3::modulation::FixedSquare<150>().with_loop_behavior(autd3::driver::LoopBehavior::once());
+  ASSERT_TRUE(autd.send(m));
+  const auto [buf, config] = autd3::driver::calc_modulation(autd3::modulation::Square(150));
+  ASSERT_EQ(config, m.sampling_config());
+  for (auto& dev : autd.geometry()) {
+    auto mod = autd.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+    ASSERT_TRUE(std::ranges::equal(mod, buf, [](const uint8_t a, const autd3::driver::EmitIntensity b) { return a == b.value(); }));
+    ASSERT_EQ(autd3::driver::LoopBehavior::once(), autd.link().modulation_loop_behavior(dev.idx(), autd3::native_methods::Segment::S0));
+  }
+
+  ASSERT_TRUE(std::ranges::equal(autd3::driver::calc_modulation(autd3::modulation::Square(200)).first,
+                                 autd3::modulation::FixedSquare<200>().buffer()));
+}
@@ -28,3 +28,32 @@ TEST(Modulation, Fourier) {
     ASSERT_EQ(5120, autd.link().modulation_frequency_division(dev.idx(), autd3::native_methods::Segment::S0));
   }
 }
+
+TEST(Modulation, FourierManyComponents) {
+  auto autd = create_controller();
+
+  auto m = autd3::modulation::Fourier(autd3::modulation::Sine(10));
+  for (int f = 20; f <= 1000; f += 10) m.add_component(autd3::modulation::Sine(f));
+  ASSERT_EQ(400, m.size());
+  ASSERT_EQ(autd3::driver::SamplingConfiguration::from_frequency_division(5120), m.sampling_config());
+  const auto* data = m.buffer().data();
+  ASSERT_EQ(data, m.buffer().data());
+
+  ASSERT_TRUE(autd.send(m));
+  for (auto& dev : autd.geometry()) {
+    auto mod = autd.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+    ASSERT_TRUE(std::ranges::equal(mod, m.buffer(), [](const uint8_t a, const autd3::driver::EmitIntensity b) { return a == b.value(); }));
+    ASSERT_EQ(autd3::driver::EmitIntensity(127), m.buffer()[0]);
+  }
+
+  m.add_component(autd3::modulation::Sine(3));
+  ASSERT_EQ(4000, m.size());
+}
+
+TEST(Modulation, FourierSamplingConfigMismatch) {
+  auto autd = create_controller();
+
+  const auto m = autd3::modulation::Sine(100) +
+                 autd3::modulation::Sine(100).with_sampling_config(autd3::driver::SamplingConfiguration::from_frequency_division(10240));
+  ASSERT_THROW(autd.send(m), autd3::AUTDException);
+}
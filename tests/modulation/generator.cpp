@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include <autd3/modulation/generator.hpp>
+#include <autd3/modulation/stream.hpp>
+#include <numeric>
+
+#include "utils.hpp"
+
+namespace {
+coro::generator<autd3::driver::EmitIntensity> ramp(const size_t n) {
+  for (size_t i = 0; i < n; i++) co_yield autd3::driver::EmitIntensity(static_cast<uint8_t>(i));
+}
+}  // namespace
+
+TEST(Modulation, Generator) {
+  autd3::modulation::Generator gen(ramp(7), 3);
+  ASSERT_EQ(3, gen.chunk_size());
+  ASSERT_EQ(4000, gen.sampling_config().frequency());
+
+  std::vector buf(4, autd3::driver::EmitIntensity::minimum());
+  ASSERT_EQ(4, gen.read(buf));
+  ASSERT_EQ(3, buf[3].value());
+  ASSERT_FALSE(gen.done());
+
+  const auto chunk = gen.next();
+  ASSERT_TRUE(chunk.has_value());
+  ASSERT_EQ(3, chunk->size());
+  ASSERT_EQ(4, (*chunk)[0].value());
+  ASSERT_EQ(6, (*chunk)[2].value());
+
+  ASSERT_TRUE(gen.done());
+  ASSERT_FALSE(gen.next().has_value());
+  ASSERT_EQ(0, gen.read(buf));
+
+  ASSERT_THROW(autd3::modulation::Generator(ramp(1), 1), autd3::AUTDException);
+}
+
+TEST(Modulation, GeneratorPadding) {
+  autd3::modulation::Generator gen(ramp(4), 3);
+  ASSERT_EQ(3, gen.next()->size());
+  const auto last = gen.next();
+  ASSERT_EQ(2, last->size());
+  ASSERT_EQ(3, (*last)[0].value());
+  ASSERT_EQ(3, (*last)[1].value());
+}
+
+TEST(Modulation, GeneratorReuseBuffer) {
+  autd3::modulation::Generator gen(ramp(12), 3);
+  const auto* data = gen.next()->data();
+  ASSERT_EQ(data, gen.next()->data());
+
+  const auto held = gen.next();
+  const auto next = gen.next();
+  ASSERT_NE(held->data(), next->data());
+  ASSERT_EQ(6, (*held)[0].value());
+  ASSERT_EQ(9, (*next)[0].value());
+}
+
+TEST(Modulation, GeneratorStream) {
+  auto autd = create_controller();
+
+  autd3::modulation::Generator gen(ramp(96), 32);
+  ASSERT_TRUE(autd3::modulation::stream(autd, gen));
+
+  for (auto& dev : autd.geometry()) {
+    ASSERT_EQ(autd3::native_methods::Segment::S0, autd.link().current_mod_segment(dev.idx()));
+    auto mod = autd.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+    std::vector<uint8_t> mod_expect(32);
+    std::iota(mod_expect.begin(), mod_expect.end(), 64);
+    ASSERT_EQ(mod_expect, mod);
+  }
+}
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include <autd3/modulation/live.hpp>
+#include <numeric>
+
+#include "utils.hpp"
+
+static std::vector<autd3::driver::EmitIntensity> ramp(const size_t n) {
+  std::vector<autd3::driver::EmitIntensity> data;
+  for (size_t i = 0; i < n; i++) data.emplace_back(static_cast<uint8_t>(i));
+  return data;
+}
+
+TEST(Modulation, LiveModulation) {
+  autd3::modulation::LiveModulation live(16, 8);
+  ASSERT_EQ(16, live.capacity());
+  ASSERT_EQ(8, live.chunk_size());
+  ASSERT_EQ(autd3::driver::SamplingConfiguration::from_frequency(4e3), live.sampling_config());
+
+  ASSERT_EQ(16, live.push(ramp(20)));
+  ASSERT_EQ(4, live.overruns());
+
+  const auto c0 = live.next();
+  ASSERT_TRUE(c0.has_value());
+  ASSERT_TRUE(std::ranges::equal(ramp(8), c0.value()));
+  (void)live.next();
+  const auto c2 = live.next();
+  ASSERT_TRUE(std::ranges::all_of(c2.value(), [](const auto v) { return v == autd3::driver::EmitIntensity(15); }));
+  ASSERT_EQ(8, live.underruns());
+
+  ASSERT_EQ(3, live.push(ramp(3)));
+  live.close();
+  const auto c3 = live.next();
+  ASSERT_TRUE(std::ranges::equal(ramp(3), c3.value()));
+  ASSERT_FALSE(live.next().has_value());
+  ASSERT_EQ(8, live.underruns());
+
+  ASSERT_THROW(autd3::modulation::LiveModulation(16, 1), autd3::AUTDException);
+}
+
+TEST(Modulation, LiveModulationStream) {
+  auto autd = create_controller();
+
+  autd3::modulation::LiveModulation live(256, 32);
+  const auto data = ramp(96);
+  ASSERT_EQ(96, live.push(data));
+
+  live.close();
+  ASSERT_TRUE(autd3::modulation::stream(autd, live));
+  ASSERT_EQ(0, live.underruns());
+
+  for (auto& dev : autd.geometry()) {
+    ASSERT_EQ(autd3::native_methods::Segment::S0, autd.link().current_mod_segment(dev.idx()));
+    auto mod = autd.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+    std::vector<uint8_t> mod_expect(32);
+    std::iota(mod_expect.begin(), mod_expect.end(), 64);
+    ASSERT_EQ(mod_expect, mod);
+  }
+}
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <autd3/modulation/custom.hpp>
+#include <autd3/modulation/mixer.hpp>
+#include <autd3/modulation/sine.hpp>
+
+#include "utils.hpp"
+
+namespace {
+autd3::modulation::Custom custom(const std::vector<uint8_t>& v, const uint32_t div) {
+  std::vector<autd3::driver::EmitIntensity> data;
+  std::ranges::transform(v, std::back_inserter(data), [](const uint8_t x) { return autd3::driver::EmitIntensity(x); });
+  return autd3::modulation::Custom(autd3::driver::ModulationBuffer(std::move(data)),
+                                   autd3::driver::SamplingConfiguration::from_frequency_division(div));
+}
+
+std::vector<uint8_t> values(const autd3::driver::ModulationBuffer& buf) {
+  std::vector<uint8_t> v;
+  std::ranges::transform(buf, std::back_inserter(v), [](const autd3::driver::EmitIntensity x) { return x.value(); });
+  return v;
+}
+}  // namespace
+
+TEST(Modulation, MixerSum) {
+  auto autd = create_controller();
+
+  const auto m = autd3::modulation::Mixer::sum(custom({10, 200}, 5120), custom({100, 50, 250}, 5120));
+  ASSERT_EQ(autd3::modulation::Mixer::Op::Sum, m.op());
+  ASSERT_EQ(6, m.size());
+  ASSERT_EQ(5120, m.sampling_config().frequency_division());
+
+  ASSERT_TRUE(autd.send(m));
+
+  for (auto& dev : autd.geometry()) {
+    auto mod = autd.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+    std::vector<uint8_t> mod_expect{110, 250, 255, 110, 60, 255};
+    ASSERT_TRUE(std::ranges::equal(mod, mod_expect));
+    ASSERT_EQ(5120, autd.link().modulation_frequency_division(dev.idx(), autd3::native_methods::Segment::S0));
+  }
+}
+
+TEST(Modulation, MixerProduct) {
+  const auto sine = autd3::modulation::Sine(150).calc();
+
+  const auto m = autd3::modulation::Mixer::product(autd3::modulation::Sine(150), custom({255, 128, 0, 255}, 5120));
+  ASSERT_EQ(80, m.size());
+  for (size_t i = 0; i < 80; i++) {
+    const auto env = std::array<uint32_t, 4>{255, 128, 0, 255}[i % 4];
+    ASSERT_EQ((sine[i].value() * env + 127) / 255, m.buffer()[i].value());
+  }
+
+  const auto copy = m;
+  ASSERT_EQ(m.buffer().data(), copy.buffer().data());
+}
+
+TEST(Modulation, MixerCrossfade) {
+  const auto m = autd3::modulation::Mixer::crossfade(custom({0, 0, 0, 0}, 5120), custom({255, 255, 255}, 5120), 3);
+  ASSERT_EQ(4, m.size());
+  ASSERT_EQ((std::vector<uint8_t>{0, 64, 128, 191}), values(m.buffer()));
+
+  const auto n = autd3::modulation::Mixer::crossfade(custom({10, 20}, 5120), custom({30, 40}, 5120), 0);
+  ASSERT_EQ((std::vector<uint8_t>{10, 20, 30, 40}), values(n.buffer()));
+
+  ASSERT_THROW((void)autd3::modulation::Mixer::crossfade(custom({10, 20}, 5120), custom({30, 40}, 5120), 3).buffer(), autd3::AUTDException);
+}
+
+TEST(Modulation, MixerResample) {
+  const auto m = autd3::modulation::Mixer::sum(custom({100, 100, 100}, 10240), custom({0, 10}, 5120));
+  ASSERT_EQ(5120, m.sampling_config().frequency_division());
+  ASSERT_EQ(6, m.size());
+  ASSERT_EQ((std::vector<uint8_t>{100, 110, 100, 110, 100, 110}), values(m.buffer()));
+
+  const auto n = autd3::modulation::Mixer::sum(custom({100, 100, 100}, 10240), custom({0, 10}, 5120))
+                     .with_sampling_config(autd3::driver::SamplingConfiguration::from_frequency_division(10240));
+  ASSERT_EQ(10240, n.sampling_config().frequency_division());
+  ASSERT_EQ(3, n.size());
+}
@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+
+#include <autd3/modulation/resampler.hpp>
+#include <cmath>
+#include <tuple>
+#include <vector>
+
+TEST(Modulation, PolyphaseResamplerIdentity) {
+  std::vector<double> in(100);
+  for (size_t i = 0; i < in.size(); i++) in[i] = std::sin(static_cast<double>(i) * 0.1);
+
+  autd3::modulation::PolyphaseResampler resampler(4000, 4000);
+  ASSERT_EQ(1, resampler.up());
+  ASSERT_EQ(1, resampler.down());
+  ASSERT_EQ(in, resampler.resample(in));
+}
+
+TEST(Modulation, PolyphaseResampler) {
+  std::vector<double> in(1000);
+  for (size_t i = 0; i < in.size(); i++) in[i] = 0.5 + 0.4 * std::sin(static_cast<double>(i) * 0.05);
+
+  constexpr uint64_t clk = autd3::native_methods::FPGA_CLK_FREQ;
+  for (const auto& [in_rate, num, den] :
+       std::vector<std::tuple<uint64_t, uint64_t, uint64_t>>{{4000, 3000, 1}, {3000, 4000, 1}, {44100, clk, 5120}, {4000, clk, 5121}}) {
+    autd3::modulation::PolyphaseResampler whole(in_rate, num, den);
+    const auto expect = whole.resample(in);
+    const auto ratio = static_cast<double>(den * in_rate) / static_cast<double>(num);
+    ASSERT_EQ(static_cast<size_t>(std::ceil(static_cast<double>(in.size()) / ratio)), expect.size());
+    for (size_t n = 0; n < expect.size(); n++) {
+      const auto t = static_cast<double>(n) * ratio;
+      if (t > 100.0 && t < 900.0) {
+        ASSERT_NEAR(0.5 + 0.4 * std::sin(t * 0.05), expect[n], 1e-2);
+      }
+    }
+
+    std::vector<double> actual;
+    autd3::modulation::PolyphaseResampler chunked(in_rate, num, den);
+    for (size_t i = 0; i < in.size(); i += 13) chunked.process(std::span(in).subspan(i, std::min<size_t>(13, in.size() - i)), actual);
+    chunked.flush(actual);
+    ASSERT_EQ(expect, actual);
+  }
+}
+
+TEST(Modulation, PolyphaseResamplerTaps) {
+  ASSERT_EQ(32, autd3::modulation::PolyphaseResampler(3000, 4000).taps());
+  ASSERT_EQ(64, autd3::modulation::PolyphaseResampler(3000, 4000, 1, 32).taps());
+  ASSERT_EQ(44, autd3::modulation::PolyphaseResampler(4000, 3000).taps());
+  ASSERT_THROW(autd3::modulation::PolyphaseResampler(0, 4000), autd3::AUTDException);
+  ASSERT_THROW(autd3::modulation::PolyphaseResampler(4000, 4000, 1, 0), autd3::AUTDException);
+}
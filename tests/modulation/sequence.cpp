@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <autd3/modulation/custom.hpp>
+#include <autd3/modulation/sequence.hpp>
+#include <autd3/modulation/sine.hpp>
+#include <autd3/modulation/stream.hpp>
+
+#include "utils.hpp"
+
+namespace {
+autd3::driver::ModulationBuffer buffer(const std::vector<uint8_t>& v) {
+  std::vector<autd3::driver::EmitIntensity> data;
+  std::ranges::transform(v, std::back_inserter(data), [](const uint8_t x) { return autd3::driver::EmitIntensity(x); });
+  return autd3::driver::ModulationBuffer(std::move(data));
+}
+}  // namespace
+
+TEST(Modulation, Sequence) {
+  auto autd = create_controller();
+
+  const auto config = autd3::driver::SamplingConfiguration::from_frequency_division(10240);
+  const auto a = autd3::modulation::Custom(buffer({0x00, 0x10, 0x20, 0x30}), config);
+  const auto b = buffer({0x80, 0xFF});
+  auto seq = autd3::modulation::Sequence(config).add(a, 1, 2).add(b).add(a);
+  ASSERT_EQ(3, seq.clips().size());
+  ASSERT_EQ(a.buffer().data() + 1, seq.clips()[0].data());
+  ASSERT_EQ(b.data(), seq.clips()[1].data());
+  ASSERT_EQ(8, seq.size());
+  ASSERT_EQ(config, seq.sampling_config());
+
+  ASSERT_TRUE(autd.send(seq));
+
+  for (auto& dev : autd.geometry()) {
+    auto mod = autd.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+    std::vector<uint8_t> mod_expect{0x10, 0x20, 0x80, 0xFF, 0x00, 0x10, 0x20, 0x30};
+    ASSERT_TRUE(std::ranges::equal(mod, mod_expect));
+    ASSERT_EQ(10240, autd.link().modulation_frequency_division(dev.idx(), autd3::native_methods::Segment::S0));
+  }
+
+  const auto* data = seq.buffer().data();
+  ASSERT_TRUE(autd.send(seq));
+  ASSERT_EQ(data, seq.buffer().data());
+
+  seq.add(b);
+  ASSERT_EQ(10, seq.buffer().size());
+
+  ASSERT_TRUE(autd.send(seq[1]));
+  for (auto& dev : autd.geometry()) {
+    auto mod = autd.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+    std::vector<uint8_t> mod_expect{0x80, 0xFF};
+    ASSERT_TRUE(std::ranges::equal(mod, mod_expect));
+  }
+}
+
+TEST(Modulation, SequenceSingleClip) {
+  const auto b = buffer({0x80, 0xFF});
+  const auto seq = autd3::modulation::Sequence(autd3::driver::SamplingConfiguration::from_frequency_division(5120)).add(b);
+  ASSERT_EQ(b.data(), seq.buffer().data());
+}
+
+TEST(Modulation, SequenceInvalid) {
+  auto seq = autd3::modulation::Sequence(autd3::driver::SamplingConfiguration::from_frequency_division(5120));
+  ASSERT_THROW((void)seq.buffer(), autd3::AUTDException);
+  ASSERT_THROW(seq.add(buffer({0x80})), autd3::AUTDException);
+  ASSERT_THROW(seq.add(autd3::modulation::Custom(buffer({0x00, 0xFF}), autd3::driver::SamplingConfiguration::from_frequency_division(10240))),
+               autd3::AUTDException);
+  ASSERT_THROW(seq.add(autd3::modulation::Custom(buffer({0x00, 0xFF}), autd3::driver::SamplingConfiguration::from_frequency_division(5120)), 1, 2),
+               std::out_of_range);
+}
+
+TEST(Modulation, SequenceStream) {
+  auto autd = create_controller();
+
+  const auto m = autd3::modulation::Sine(150).with_cache();
+  const auto seq = autd3::modulation::Sequence(m.sampling_config()).add(m, 0, 40).add(m, 40, 40).add(m, 0, 10);
+  auto chunks = seq.chunks();
+  ASSERT_TRUE(autd3::modulation::stream(autd, chunks));
+  ASSERT_FALSE(chunks.next().has_value());
+
+  for (auto& dev : autd.geometry()) {
+    ASSERT_EQ(autd3::native_methods::Segment::S0, autd.link().current_mod_segment(dev.idx()));
+    auto mod = autd.link().modulation(dev.idx(), autd3::native_methods::Segment::S0);
+    ASSERT_TRUE(std::ranges::equal(mod, m.buffer().span().subspan(0, 10), [](const uint8_t a, const autd3::driver::EmitIntensity b) {
+      return a == b.value();
+    }));
+    mod = autd.link().modulation(dev.idx(), autd3::native_methods::Segment::S1);
+    ASSERT_TRUE(std::ranges::equal(mod, m.buffer().span().subspan(40, 40), [](const uint8_t a, const autd3::driver::EmitIntensity b) {
+      return a == b.value();
+    }));
+  }
+}
@@ -61,3 +61,19 @@ TEST(Modulation, SineDefault) {
   const auto m = autd3::modulation::Sine(150);
   ASSERT_TRUE(AUTDModulationSineIsDefault(m.modulation_ptr()));
 }
+
+TEST(Modulation, SineCalc) {
+  auto autd = create_controller();
+
+  for (const auto& m : {autd3::modulation::Sine(150).with_intensity(0x80).with_offset(0x40).with_phase(autd3::driver::Phase(32)),
+                        autd3::modulation::Sine(150.5).with_mode(autd3::native_methods::SamplingMode::SizeOptimized)}) {
+    ASSERT_TRUE(autd.send(m));
+    const auto buf = m.calc();
+    for (auto& dev : autd.geometry())
+      ASSERT_TRUE(std::ranges::equal(autd.link().modulation(dev.idx(), autd3::native_methods::Segment::S0), buf,
+                                     [](const uint8_t a, const autd3::driver::EmitIntensity b) { return a == b.value(); }));
+  }
+
+  ASSERT_THROW((void)autd3::modulation::Sine(100.1).calc(), autd3::AUTDException);
+  ASSERT_THROW((void)autd3::modulation::Sine(3000).calc(), autd3::AUTDException);
+}
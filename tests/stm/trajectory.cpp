@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <autd3/stm/trajectory.hpp>
+
+#include "utils.hpp"
+
+namespace {
+
+void assert_constant_speed(const std::vector<autd3::driver::Vector3>& points, const double tolerance) {
+  std::vector<double> d;
+  for (size_t i = 0; i < points.size(); i++) d.emplace_back((points[(i + 1) % points.size()] - points[i]).norm());
+  const auto [min, max] = std::ranges::minmax(d);
+  ASSERT_GT(min, 0.0);
+  ASSERT_LE((max - min) / max, tolerance);
+}
+
+}  // namespace
+
+TEST(STM, TrajectoryCircle) {
+  const autd3::driver::Vector3 center(1, 2, 3);
+  const auto points = autd3::stm::Circle(center, 30.0).points(200);
+  ASSERT_EQ(200, points.size());
+  for (const auto& p : points) {
+    ASSERT_NEAR(30.0, (p - center).norm(), 1e-9);
+    ASSERT_NEAR(3.0, p.z(), 1e-9);
+  }
+  ASSERT_NEAR(31.0, points[0].x(), 1e-9);
+  assert_constant_speed(points, 1e-9);
+
+  for (const auto& p : autd3::stm::Circle(center, 30.0).with_normal(autd3::driver::Vector3(1, 1, 0)).points(100)) {
+    ASSERT_NEAR(30.0, (p - center).norm(), 1e-9);
+    ASSERT_NEAR(0.0, (p - center).dot(autd3::driver::Vector3(1, 1, 0)), 1e-9);
+  }
+}
+
+TEST(STM, TrajectoryLine) {
+  const autd3::driver::Vector3 start(0, 0, 0);
+  const autd3::driver::Vector3 end(10, 0, 0);
+  const auto points = autd3::stm::Line(start, end).points(4);
+  ASSERT_NEAR(0.0, (points[0] - start).norm(), 1e-9);
+  ASSERT_NEAR(0.0, (points[1] - autd3::driver::Vector3(5, 0, 0)).norm(), 1e-9);
+  ASSERT_NEAR(0.0, (points[2] - end).norm(), 1e-9);
+  ASSERT_NEAR(0.0, (points[3] - autd3::driver::Vector3(5, 0, 0)).norm(), 1e-9);
+}
+
+TEST(STM, TrajectoryPolyline) {
+  const autd3::stm::Polyline square({autd3::driver::Vector3(0, 0, 0), autd3::driver::Vector3(10, 0, 0), autd3::driver::Vector3(10, 10, 0),
+                                     autd3::driver::Vector3(0, 10, 0)});
+  ASSERT_EQ(40.0, square.length());
+  const auto points = square.points(8);
+  const std::vector expect{autd3::driver::Vector3(0, 0, 0),  autd3::driver::Vector3(5, 0, 0),   autd3::driver::Vector3(10, 0, 0),
+                           autd3::driver::Vector3(10, 5, 0), autd3::driver::Vector3(10, 10, 0), autd3::driver::Vector3(5, 10, 0),
+                           autd3::driver::Vector3(0, 10, 0), autd3::driver::Vector3(0, 5, 0)};
+  for (size_t i = 0; i < expect.size(); i++) ASSERT_NEAR(0.0, (points[i] - expect[i]).norm(), 1e-9);
+
+  ASSERT_THROW((void)autd3::stm::Polyline({autd3::driver::Vector3::Zero()}), autd3::AUTDException);
+}
+
+TEST(STM, TrajectoryLissajous) {
+  const auto points = autd3::stm::Lissajous(autd3::driver::Vector3::Zero(), 20.0, 10.0, 3, 2).with_phase(autd3::driver::pi / 2).points(4000);
+  ASSERT_EQ(4000, points.size());
+  for (const auto& p : points) {
+    ASSERT_LE(std::abs(p.x()), 20.0 + 1e-9);
+    ASSERT_LE(std::abs(p.y()), 10.0 + 1e-9);
+  }
+  assert_constant_speed(points, 1e-2);
+}
+
+TEST(STM, TrajectorySpline) {
+  const std::vector keyframes{autd3::driver::Vector3(0, 0, 0), autd3::driver::Vector3(30, 0, 0), autd3::driver::Vector3(30, 10, 0),
+                              autd3::driver::Vector3(0, 20, 0)};
+
+  const autd3::stm::CatmullRom catmull_rom(keyframes);
+  for (size_t i = 0; i < keyframes.size(); i++)
+    ASSERT_NEAR(0.0, (catmull_rom.position(static_cast<double>(i) / static_cast<double>(keyframes.size())) - keyframes[i]).norm(), 1e-9);
+  assert_constant_speed(catmull_rom.points(500), 1e-2);
+
+  const autd3::stm::BSpline b_spline(keyframes);
+  ASSERT_NEAR(0.0, (b_spline.position(0.0) - (keyframes[3] + 4.0 * keyframes[0] + keyframes[1]) / 6.0).norm(), 1e-9);
+  assert_constant_speed(b_spline.points(500), 1e-2);
+
+  ASSERT_THROW((void)autd3::stm::CatmullRom({autd3::driver::Vector3::Zero()}), autd3::AUTDException);
+  ASSERT_THROW((void)autd3::stm::BSpline({autd3::driver::Vector3::Zero()}), autd3::AUTDException);
+}
+
+TEST(STM, TrajectoryFocusSTM) {
+  auto autd = create_controller();
+
+  const autd3::driver::Vector3 center = autd.geometry().center() + autd3::driver::Vector3(0, 0, 150);
+  auto stm = autd3::driver::FocusSTM::from_freq(1);
+  autd3::stm::Circle(center, 30.0).add_to(stm, 100);
+  autd3::stm::Line(center, center + autd3::driver::Vector3(10, 0, 0)).add_to(stm, 100, autd3::driver::EmitIntensity(0x80));
+  ASSERT_TRUE(autd.send(stm));
+  for (const auto& dev : autd.geometry()) ASSERT_EQ(200u, autd.link().stm_cycle(dev.idx(), autd3::native_methods::Segment::S0));
+}